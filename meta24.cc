@@ -1,4 +1,4 @@
-#include "meta24.h"
+#include "meta24_prebuilt.h"
 
 #include <array>
 #include <iostream>
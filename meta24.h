@@ -1,4 +1,5 @@
 #include <array>
+#include <cmath>
 #include <iostream>
 #include <optional>
 #include <type_traits>
@@ -112,16 +113,22 @@ template <typename L> struct Build {
 };
 
 template <std::size_t N>
-std::optional<std::string> calc24(const std::array<double, N> &a) {
+std::optional<std::string> calc24(const std::array<double, N> &a,
+                                  double target) {
   using Values = mp11::mp_transform<Value, mp11::mp_iota_c<N>>;
   using Exprs = typename Build<Values>::type;
   std::optional<std::string> result;
   mp11::mp_for_each<Exprs>([&](auto expr_tag) {
     if (result.has_value()) return;
     using E = decltype(expr_tag);
-    if (E::eval(a) == 24) {
+    if (std::abs(E::eval(a) - target) < 1e-9) {
       result = E::print(a);
     }
   });
   return result;
-}
\ No newline at end of file
+}
+
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N> &a) {
+  return calc24(a, 24.0);
+}
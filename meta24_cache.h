@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "meta24_constexpr.h"
+
+// ============================================================================
+// meta24_cache.h — bounded, thread-safe cache of solve() results.
+//
+// Entries are keyed by the sorted hand, its size and the target, and hold a
+// SolutionHandle for the sorted hand. A lookup re-points the handle's
+// permutation at the caller's order, so every ordering of a hand shares one
+// entry.
+//
+// The cache is split into kShards independently locked shards. A hit takes
+// its shard's lock shared and only marks the entry as referenced, so
+// readers never block each other. Each shard holds a fixed number of
+// entries and evicts with CLOCK: the hand sweeps the ring, clearing
+// referenced entries, and replaces the first one that was not referenced
+// since the last sweep.
+// ============================================================================
+
+class SolutionCache {
+ public:
+  static constexpr std::size_t kShards = 64;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    std::size_t size = 0;
+  };
+
+  // Holds at least `capacity` entries in total.
+  explicit SolutionCache(std::size_t capacity)
+      : per_shard_(
+            std::max<std::size_t>(1, (capacity + kShards - 1) / kShards)) {
+    for (auto& shard : shards_) {
+      shard.slots = std::make_unique<Slot[]>(per_shard_);
+      shard.index.reserve(per_shard_);
+    }
+  }
+
+  // solve(a, target), from the cache when possible.
+  template <std::size_t N>
+  SolutionHandle solve(const std::array<double, N>& a, double target = 24.0) {
+    static_assert(N <= kMaxHandleInputs);
+    // order[k] is the input holding the k-th smallest value.
+    std::array<std::size_t, N> order;
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t x, std::size_t y) { return a[x] < a[y]; });
+    std::array<double, N> sorted;
+    Key key;
+    key.n = N;
+    key.target = target + 0.0;  // -0 and +0 share an entry
+    for (std::size_t k = 0; k < N; ++k) {
+      sorted[k] = a[order[k]];
+      key.values[k] = sorted[k] + 0.0;
+    }
+
+    Shard& shard = shards_[KeyHash{}(key) % kShards];
+    SolutionHandle h;
+    if (!lookup(shard, key, h)) {
+      h = ::solve(sorted, target);
+      insert(shard, key, h);
+    }
+    if (!h.solved()) return h;
+
+    // Program input k reads sorted[input(k)], which is a[order[input(k)]].
+    SolutionHandle result = h;
+    result.perm = 0;
+    for (std::size_t k = 0; k < N; ++k) {
+      result.perm |= static_cast<uint64_t>(order[h.input(k)]) << (3 * k);
+    }
+    return result;
+  }
+
+  template <std::size_t N>
+  std::optional<std::string> calc24(const std::array<double, N>& a,
+                                    double target = 24.0) {
+    const SolutionHandle h = solve(a, target);
+    if (!h.solved()) return std::nullopt;
+    return format(h, a);
+  }
+
+  Stats stats() const {
+    Stats s;
+    for (const auto& shard : shards_) {
+      s.hits += shard.hits.load(std::memory_order_relaxed);
+      s.misses += shard.misses.load(std::memory_order_relaxed);
+      s.evictions += shard.evictions.load(std::memory_order_relaxed);
+      std::shared_lock lock(shard.mutex);
+      s.size += shard.index.size();
+    }
+    return s;
+  }
+
+ private:
+  struct Key {
+    std::array<double, kMaxHandleInputs> values{};
+    double target = 0;
+    uint8_t n = 0;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& k) const {
+      uint64_t h = 0xcbf29ce484222325ULL ^ k.n;
+      for (std::size_t i = 0; i < k.n; ++i) {
+        h = (h ^ std::bit_cast<uint64_t>(k.values[i])) * 0x100000001b3ULL;
+      }
+      h = (h ^ std::bit_cast<uint64_t>(k.target)) * 0x100000001b3ULL;
+      // Small integral doubles differ only in their high bits; mix them
+      // down, since the shard is picked from the low ones.
+      h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdULL;
+      h = (h ^ (h >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+      return h ^ (h >> 33);
+    }
+  };
+
+  struct Slot {
+    Key key;
+    SolutionHandle handle;
+    std::atomic<bool> referenced{false};
+  };
+
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, uint32_t, KeyHash> index;  // key -> slot
+    std::unique_ptr<Slot[]> slots;
+    std::size_t hand = 0;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+  };
+
+  bool lookup(Shard& shard, const Key& key, SolutionHandle& h) {
+    {
+      std::shared_lock lock(shard.mutex);
+      const auto it = shard.index.find(key);
+      if (it != shard.index.end()) {
+        Slot& slot = shard.slots[it->second];
+        h = slot.handle;
+        // Skip the store when already set, to keep the line shared.
+        if (!slot.referenced.load(std::memory_order_relaxed)) {
+          slot.referenced.store(true, std::memory_order_relaxed);
+        }
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  void insert(Shard& shard, const Key& key, const SolutionHandle& h) {
+    std::unique_lock lock(shard.mutex);
+    // Another thread may have solved the same hand meanwhile.
+    if (shard.index.contains(key)) return;
+
+    std::size_t victim;
+    if (shard.index.size() < per_shard_) {
+      victim = shard.index.size();
+    } else {
+      while (shard.slots[shard.hand].referenced.exchange(
+          false, std::memory_order_relaxed)) {
+        shard.hand = (shard.hand + 1) % per_shard_;
+      }
+      victim = shard.hand;
+      shard.hand = (shard.hand + 1) % per_shard_;
+      shard.index.erase(shard.slots[victim].key);
+      shard.evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    Slot& slot = shard.slots[victim];
+    slot.key = key;
+    slot.handle = h;
+    slot.referenced.store(false, std::memory_order_relaxed);
+    shard.index.emplace(key, static_cast<uint32_t>(victim));
+  }
+
+  std::size_t per_shard_;
+  std::array<Shard, kShards> shards_;
+};
@@ -0,0 +1,81 @@
+#include "meta24_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(SolutionCacheTest, PermutedHandsShareAnEntry) {
+  SolutionCache cache(1024);
+  const std::array<double, 4> hand{8, 3, 8, 3};
+  EXPECT_EQ(cache.calc24(hand), calc24(std::array<double, 4>{3, 3, 8, 8}));
+
+  std::array<double, 4> shuffled{3, 8, 3, 8};
+  const auto result = cache.calc24(shuffled);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, *calc24(std::array<double, 4>{3, 3, 8, 8}));
+
+  EXPECT_FALSE(cache.calc24(std::array<double, 4>{1, 1, 1, 1}).has_value());
+  EXPECT_FALSE(cache.calc24(std::array<double, 4>{1, 1, 1, 1}).has_value());
+  EXPECT_TRUE(cache.calc24(std::array<double, 4>{1, 1, 1, 1}, 4).has_value());
+
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.size, 3u);
+}
+
+// A handle from the cache must render over the caller's own order.
+TEST(SolutionCacheTest, MatchesSolve) {
+  SolutionCache cache(4096);
+  std::array<double, 5> a;
+  for (int h = 0; h < 4 * 4 * 4 * 4 * 4; ++h) {
+    for (int i = 0, rest = h; i < 5; ++i, rest /= 4) a[i] = rest % 4 + 1;
+    const SolutionHandle cached = cache.solve(a);
+    ASSERT_EQ(cached.solved(), solve(a).solved());
+    if (cached.solved()) {
+      auto sorted = a;
+      std::sort(sorted.begin(), sorted.end());
+      EXPECT_EQ(format(cached, a), *calc24(sorted));
+    }
+  }
+  // One entry per multiset of 5 values in 1..4.
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.size, 56u);
+  EXPECT_EQ(stats.misses, 56u);
+  EXPECT_EQ(stats.evictions, 0u);
+}
+
+TEST(SolutionCacheTest, EvictsAtCapacity) {
+  SolutionCache cache(SolutionCache::kShards);
+  std::array<double, 4> a;
+  for (int h = 0; h < 13 * 13 * 13 * 13; ++h) {
+    for (int i = 0, rest = h; i < 4; ++i, rest /= 13) a[i] = rest % 13 + 1;
+    ASSERT_EQ(cache.solve(a).solved(), solve(a).solved());
+  }
+  const auto stats = cache.stats();
+  EXPECT_LE(stats.size, SolutionCache::kShards);
+  EXPECT_GT(stats.evictions, 0u);
+  EXPECT_EQ(stats.misses - stats.evictions, stats.size);
+}
+
+TEST(SolutionCacheTest, ConcurrentReaders) {
+  SolutionCache cache(256);
+  constexpr int kThreads = 8;
+  constexpr int kCalls = 2000;
+  {
+    std::vector<std::jthread> workers;
+    for (int t = 0; t < kThreads; ++t) {
+      workers.emplace_back([&cache, t] {
+        for (int i = 0; i < kCalls; ++i) {
+          const double x = (i + t) % 13 + 1;
+          const std::array<double, 4> hand{x, 13 - x + 1, 4, 6};
+          EXPECT_EQ(cache.solve(hand).solved(), solve(hand).solved());
+        }
+      });
+    }
+  }
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, uint64_t{kThreads * kCalls});
+  EXPECT_LE(stats.size, 13u);
+}
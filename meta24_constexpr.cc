@@ -1,14 +1,29 @@
-#include "meta24_constexpr.h"
+#include "meta24_prebuilt.h"
 
 #include <array>
+#include <cstring>
 #include <iostream>
 #include <optional>
 
-int main() {
+#include "meta24_stream.h"
+
+// With --binary, writes a result stream (meta24_stream.h) instead of text;
+// meta24_decode turns it back into the text below.
+int main(int argc, char** argv) {
+  const bool binary = argc > 1 && std::strcmp(argv[1], "--binary") == 0;
   srand(123);
 
   constexpr int N = 4;
   std::array<double, N> nums;
+  if (binary) {
+    result_stream::Writer writer(std::cout, N);
+    for (int i = 0; i < 100000; i++) {
+      for (int j = 0; j < N; j++) nums[j] = rand() % 13 + 1;
+      writer.add(nums, solve(nums));
+    }
+    return writer.finish() ? 0 : 1;
+  }
+
   for (int i = 0; i < 100000; i++) {
     std::string challenge;
     for (int j = 0; j < N; j++) {
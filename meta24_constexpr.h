@@ -1,11 +1,28 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <stop_token>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "meta24_program_order.h"
 
 // ============================================================================
 // meta24_constexpr.h — C++20 constexpr metaprogramming rewrite of meta24.h
@@ -38,9 +55,10 @@ struct ExprNode {
 // ExprTree: a complete expression tree stored as a flat node array.
 //
 // For N inputs we have at most N leaves + (N-1) interior nodes = 2N-1 nodes.
-// Max N=4 → max 7 nodes.
+// Tables are generated for at most kMaxInputs inputs → max 7 nodes.
 // ---------------------------------------------------------------------------
-constexpr std::size_t kMaxNodes = 7;
+constexpr std::size_t kMaxInputs = 4;
+constexpr std::size_t kMaxNodes = 2 * kMaxInputs - 1;
 
 struct ExprTree {
   std::array<ExprNode, kMaxNodes> nodes{};
@@ -149,7 +167,7 @@ template <std::size_t Total>
 constexpr void generate(
     std::array<ExprTree, Total>& out,
     std::size_t& idx,
-    std::array<Item, 4>& items,  // max N=4
+    std::array<Item, kMaxInputs>& items,
     std::size_t n)
 {
   if (n == 1) {
@@ -168,7 +186,7 @@ constexpr void generate(
         }
 
         // Build the reduced item list: remove i and j, add combined.
-        std::array<Item, 4> reduced{};
+        std::array<Item, kMaxInputs> reduced{};
         std::size_t ri = 0;
         for (std::size_t k = 0; k < n; ++k) {
           if (k != i && k != j) reduced[ri++] = items[k];
@@ -188,10 +206,11 @@ constexpr void generate(
 // ---------------------------------------------------------------------------
 template <std::size_t N>
 constexpr auto generate_programs() {
+  static_assert(N <= kMaxInputs);
   constexpr std::size_t Total = count_programs(N);
   std::array<ExprTree, Total> trees{};
 
-  std::array<detail::Item, 4> items{};
+  std::array<detail::Item, kMaxInputs> items{};
   for (std::size_t i = 0; i < N; ++i) {
     items[i] = detail::Item{static_cast<uint8_t>(i)};
   }
@@ -201,9 +220,23 @@ constexpr auto generate_programs() {
   return trees;
 }
 
+// All expression trees for N inputs, materialised once per N.
+template <std::size_t N>
+inline constexpr auto kPrograms = generate_programs<N>();
+
 // ---------------------------------------------------------------------------
 // Runtime evaluation — direct tree traversal, no stack needed.
 // ---------------------------------------------------------------------------
+inline double apply_op(Op op, double a, double b) {
+  switch (op) {
+    case Op::Add: return a + b;
+    case Op::Sub: return a - b;
+    case Op::Mul: return a * b;
+    case Op::Div: return a / b;
+  }
+  return 0.0;  // unreachable
+}
+
 inline double eval_node(const ExprTree& tree, uint8_t node_idx,
                         const double* inputs) {
   const auto& n = tree.nodes[node_idx];
@@ -211,14 +244,7 @@ inline double eval_node(const ExprTree& tree, uint8_t node_idx,
 
   double a = eval_node(tree, n.left, inputs);
   double b = eval_node(tree, n.right, inputs);
-
-  switch (n.op) {
-    case Op::Add: return a + b;
-    case Op::Sub: return a - b;
-    case Op::Mul: return a * b;
-    case Op::Div: return a / b;
-  }
-  return 0.0;  // unreachable
+  return apply_op(n.op, a, b);
 }
 
 inline double eval_tree(const ExprTree& tree, const double* inputs) {
@@ -241,21 +267,15 @@ inline std::string parenthesize(const PrintResult& r) {
   return "(" + r.text + ")";
 }
 
-template <std::size_t N>
-PrintResult print_node(const ExprTree& tree, uint8_t node_idx,
-                       const std::array<double, N>& inputs) {
-  const auto& n = tree.nodes[node_idx];
-  if (n.is_leaf) {
-    return {std::to_string(static_cast<int>(inputs[n.input])), 3};
-  }
-
-  auto a = print_node(tree, n.left, inputs);
-  auto b = print_node(tree, n.right, inputs);
+inline PrintResult print_leaf(double value) {
+  return {std::to_string(static_cast<int>(value)), 3};
+}
 
+inline PrintResult print_op(Op op, const PrintResult& a, const PrintResult& b) {
   std::string result;
-  int prec;
+  int prec = 1;
 
-  switch (n.op) {
+  switch (op) {
     case Op::Add:
       prec = 1;
       result = a.text + " + " + b.text;
@@ -279,6 +299,17 @@ PrintResult print_node(const ExprTree& tree, uint8_t node_idx,
   return {std::move(result), prec};
 }
 
+template <std::size_t N>
+PrintResult print_node(const ExprTree& tree, uint8_t node_idx,
+                       const std::array<double, N>& inputs) {
+  const auto& n = tree.nodes[node_idx];
+  if (n.is_leaf) return print_leaf(inputs[n.input]);
+
+  auto a = print_node(tree, n.left, inputs);
+  auto b = print_node(tree, n.right, inputs);
+  return print_op(n.op, a, b);
+}
+
 }  // namespace detail
 
 template <std::size_t N>
@@ -288,18 +319,893 @@ std::string print_tree(const ExprTree& tree,
 }
 
 // ---------------------------------------------------------------------------
-// Public API — matches the original calc24() signature.
+// Search order
+//
+// Tables are scanned in a profile-guided order instead of generate order:
+// meta24_profile solves a training corpus and moves the programs that solve
+// the most hands to the front (see meta24_program_order.h). Program indices,
+// and therefore handles, are unaffected; only the order they are tried in.
+// ---------------------------------------------------------------------------
+namespace detail {
+
+template <std::size_t Size>
+constexpr bool is_permutation(const uint16_t (&order)[Size]) {
+  std::array<bool, Size> seen{};
+  for (uint16_t p : order) {
+    if (p >= Size || seen[p]) return false;
+    seen[p] = true;
+  }
+  return true;
+}
+
+// A single input has a single program.
+inline constexpr uint16_t kProgramOrder1[] = {0};
+
+static_assert(std::size(kProgramOrder2) == count_programs(2) &&
+              is_permutation(kProgramOrder2));
+static_assert(std::size(kProgramOrder3) == count_programs(3) &&
+              is_permutation(kProgramOrder3));
+static_assert(std::size(kProgramOrder4) == count_programs(4) &&
+              is_permutation(kProgramOrder4));
+
+template <std::size_t N>
+constexpr std::span<const uint16_t> program_order() {
+  static_assert(N <= kMaxInputs);
+  if constexpr (N == 4) {
+    return kProgramOrder4;
+  } else if constexpr (N == 3) {
+    return kProgramOrder3;
+  } else if constexpr (N == 2) {
+    return kProgramOrder2;
+  } else {
+    return kProgramOrder1;
+  }
+}
+
+}  // namespace detail
+
+// ---------------------------------------------------------------------------
+// Multiset-aware pruning
+//
+// A hand with repeated values fixes a "multiplicity pattern": class[i] is the
+// lowest index holding the same value as input i. Two programs whose trees
+// are identical once every leaf is replaced by its class evaluate and print
+// identically for every hand with that pattern, so only the first of them in
+// search order needs to be tried. For all-distinct hands this still drops
+// trees that differ only in the order independent pairs were reduced.
+//
+// The kept program indices are computed once per pattern, the first time a
+// given N is solved.
 // ---------------------------------------------------------------------------
+namespace detail {
+
+constexpr std::size_t pow_n(std::size_t n, std::size_t e) {
+  return e == 0 ? 1 : n * pow_n(n, e - 1);
+}
+
+// Prefix serialisation of the tree, 4 bits per node: ops are 0–3, leaves are
+// 4 + class of their input.
+inline uint64_t shape_key(const ExprTree& tree, uint8_t node_idx,
+                          const uint8_t* classes, uint64_t key) {
+  const auto& n = tree.nodes[node_idx];
+  if (n.is_leaf) return (key << 4) | (4 + classes[n.input]);
+  key = (key << 4) | static_cast<uint8_t>(n.op);
+  key = shape_key(tree, n.left, classes, key);
+  return shape_key(tree, n.right, classes, key);
+}
+
+// Pattern id: classes read as a base-N number, class[0] least significant.
 template <std::size_t N>
-std::optional<std::string> calc24(const std::array<double, N>& a) {
-  // Expression trees are generated at compile time.
-  constexpr auto trees = generate_programs<N>();
+std::size_t pattern_of(const std::array<double, N>& a) {
+  std::size_t id = 0;
+  for (std::size_t i = N; i-- > 0;) {
+    std::size_t c = i;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (a[j] == a[i]) {
+        c = j;
+        break;
+      }
+    }
+    id = id * N + c;
+  }
+  return id;
+}
 
-  for (const auto& tree : trees) {
-    double result = eval_tree(tree, a.data());
-    if (std::abs(result - 24.0) < 1e-9) {
-      return print_tree(tree, a);
+template <std::size_t N>
+using PrunedTables = std::array<std::vector<uint16_t>, pow_n(N, N)>;
+
+template <std::size_t N>
+PrunedTables<N> build_pruned_tables(std::span<const uint16_t> order) {
+  static_assert(count_programs(N) <= UINT16_MAX + 1);
+  PrunedTables<N> tables;
+  for (std::size_t id = 0; id < tables.size(); ++id) {
+    std::array<uint8_t, N> classes{};
+    bool valid = true;
+    for (std::size_t i = 0, rest = id; i < N; ++i, rest /= N) {
+      classes[i] = static_cast<uint8_t>(rest % N);
+      // A class names the first input with that value.
+      valid = valid && classes[i] <= i && classes[classes[i]] == classes[i];
+    }
+    if (!valid) continue;
+
+    std::unordered_set<uint64_t> seen;
+    for (uint16_t p : order) {
+      const auto& tree = kPrograms<N>[p];
+      if (seen.insert(shape_key(tree, tree.root, classes.data(), 0)).second) {
+        tables[id].push_back(p);
+      }
     }
   }
-  return std::nullopt;
+  return tables;
 }
+
+// Indices into kPrograms<N> worth evaluating for hand `a`, in search order.
+template <std::size_t N>
+const std::vector<uint16_t>& pruned_programs(const std::array<double, N>& a) {
+  static const PrunedTables<N> tables =
+      build_pruned_tables<N>(program_order<N>());
+  return tables[pattern_of(a)];
+}
+
+}  // namespace detail
+
+// ---------------------------------------------------------------------------
+// Runtime search for hands larger than kMaxInputs
+//
+// Past kMaxInputs a table is no longer practical (233280 trees for N=5), so
+// generate()'s recursion is replayed over values instead of nodes. The
+// enumeration order is the same, which keeps program indices meaningful for
+// any N: an index is a mixed-radix number whose digit at n items is the
+// (pair, op) choice, weighted by count_programs(n - 1).
+// ---------------------------------------------------------------------------
+namespace detail {
+
+constexpr std::size_t kOpChoices = std::size(kCombinedOps);
+
+// Depth-first reduction of values[0..n), whose first program has index
+// `base`, down to `stop` items. Calls visit(values, base) for every reduced
+// list of `stop` items, in order, and stops as soon as visit returns true.
+//
+// A pair whose values repeat an earlier pair at the same level leaves the
+// same multiset behind and cannot reach anything new, and neither can the
+// swapped variants of a pair of equal values; both are skipped without
+// changing which program reaches a value first.
+template <std::size_t N, typename Visit>
+bool reduce(const std::array<double, N>& values, std::size_t n,
+            std::size_t stop, uint64_t base, Visit&& visit) {
+  if (n == stop) return visit(values, base);
+
+  const uint64_t stride = count_programs(n - 1);
+  uint64_t choice = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = i + 1; j < n; ++j, choice += kOpChoices) {
+      bool repeated = false;
+      for (std::size_t pi = 0; pi <= i && !repeated; ++pi) {
+        for (std::size_t pj = pi + 1; pj < n; ++pj) {
+          if (pi == i && pj == j) break;
+          if ((values[pi] == values[i] && values[pj] == values[j]) ||
+              (values[pi] == values[j] && values[pj] == values[i])) {
+            repeated = true;
+            break;
+          }
+        }
+      }
+      if (repeated) continue;
+
+      std::array<double, N> reduced{};
+      std::size_t ri = 0;
+      for (std::size_t k = 0; k < n; ++k) {
+        if (k != i && k != j) reduced[ri++] = values[k];
+      }
+      for (std::size_t c = 0; c < kOpChoices; ++c) {
+        const auto& cop = kCombinedOps[c];
+        if (cop.swap && values[i] == values[j]) continue;
+        reduced[ri] = cop.swap ? apply_op(cop.op, values[j], values[i])
+                               : apply_op(cop.op, values[i], values[j]);
+        if (reduce(reduced, n - 1, stop, base + (choice + c) * stride,
+                   visit)) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// Calls visit(value, program) for every program over values[0..n).
+template <std::size_t N, typename Visit>
+bool enumerate(const std::array<double, N>& values, std::size_t n,
+               uint64_t base, Visit&& visit) {
+  return reduce(values, n, 1, base,
+                [&](const std::array<double, N>& v, uint64_t program) {
+                  return visit(v[0], program);
+                });
+}
+
+// First program evaluating to `target`; on a hit stores its index in `found`.
+template <std::size_t N>
+bool search(const std::array<double, N>& values, std::size_t n,
+            uint64_t base, uint64_t& found, double target = 24.0) {
+  return enumerate(values, n, base, [&](double v, uint64_t program) {
+    if (!(std::abs(v - target) < 1e-9)) return false;
+    found = program;
+    return true;
+  });
+}
+
+// Render program `program` over inputs `a` by replaying its choices.
+template <std::size_t N>
+std::string format_program(uint64_t program, const std::array<double, N>& a) {
+  std::array<PrintResult, N> items;
+  for (std::size_t k = 0; k < N; ++k) items[k] = print_leaf(a[k]);
+
+  for (std::size_t n = N; n > 1; --n) {
+    const uint64_t stride = count_programs(n - 1);
+    const uint64_t choice = program / stride;
+    program %= stride;
+
+    std::size_t pair = choice / kOpChoices;
+    std::size_t i = 0;
+    while (pair >= n - 1 - i) pair -= n - 1 - i++;
+    const std::size_t j = i + 1 + pair;
+
+    const auto& cop = kCombinedOps[choice % kOpChoices];
+    PrintResult combined = cop.swap ? print_op(cop.op, items[j], items[i])
+                                    : print_op(cop.op, items[i], items[j]);
+    std::array<PrintResult, N> reduced;
+    std::size_t ri = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+      if (k != i && k != j) reduced[ri++] = std::move(items[k]);
+    }
+    reduced[ri] = std::move(combined);
+    items = std::move(reduced);
+  }
+  return items[0].text;
+}
+
+}  // namespace detail
+
+// ---------------------------------------------------------------------------
+// Solution handles
+//
+// A handle names a solution without rendering it: the index of the program
+// that evaluates to the target, plus the input permutation it was found under
+// (program input k reads hand[input(k)]). Program indices follow generate
+// order for every N, so handles stay valid up to kMaxHandleInputs inputs.
+// ---------------------------------------------------------------------------
+constexpr std::size_t kMaxHandleInputs = 8;
+
+struct SolutionHandle {
+  static constexpr uint64_t kNoProgram = (uint64_t{1} << 40) - 1;
+
+  uint64_t program : 40 = kNoProgram;
+  uint64_t perm : 24 = 0;  // 3 bits per program input
+
+  bool solved() const { return program != kNoProgram; }
+  std::size_t input(std::size_t k) const { return perm >> (3 * k) & 7; }
+};
+
+static_assert(sizeof(SolutionHandle) == 8);
+static_assert(count_programs(kMaxHandleInputs) < SolutionHandle::kNoProgram);
+
+constexpr uint32_t identity_perm(std::size_t n) {
+  uint32_t perm = 0;
+  for (std::size_t k = 0; k < n; ++k) {
+    perm |= static_cast<uint32_t>(k) << (3 * k);
+  }
+  return perm;
+}
+
+// Find the first program evaluating to `target` over `a`, in search order.
+template <std::size_t N>
+SolutionHandle solve(const std::array<double, N>& a, double target = 24.0) {
+  static_assert(N <= kMaxHandleInputs);
+  SolutionHandle h;
+  h.perm = identity_perm(N);
+  if constexpr (N > kMaxInputs) {
+    uint64_t program;
+    if (detail::search(a, N, 0, program, target)) h.program = program;
+  } else {
+    // Expression trees are generated at compile time; skip those that only
+    // repeat an earlier tree over equal inputs.
+    for (uint16_t p : detail::pruned_programs(a)) {
+      double result = eval_tree(kPrograms<N>[p], a.data());
+      if (std::abs(result - target) < 1e-9) {
+        h.program = p;
+        break;
+      }
+    }
+  }
+  return h;
+}
+
+// Render a solved handle over the hand it was found for.
+template <std::size_t N>
+std::string format(const SolutionHandle& h, const std::array<double, N>& hand) {
+  std::array<double, N> inputs;
+  for (std::size_t k = 0; k < N; ++k) inputs[k] = hand[h.input(k)];
+  if constexpr (N > kMaxInputs) {
+    return detail::format_program(h.program, inputs);
+  } else {
+    return print_tree(kPrograms<N>[h.program], inputs);
+  }
+}
+
+// Solve hands[i] into out[i] for every hand; `out` must be at least as long
+// as `hands`. Returns the number of solvable hands.
+template <std::size_t N>
+std::size_t calc24_batch(std::span<const std::array<double, N>> hands,
+                         std::span<SolutionHandle> out) {
+  std::size_t solved = 0;
+  for (std::size_t i = 0; i < hands.size(); ++i) {
+    out[i] = solve(hands[i]);
+    solved += out[i].solved();
+  }
+  return solved;
+}
+
+// ---------------------------------------------------------------------------
+// Parallel search within one hand
+//
+// solve_parallel() splits the first one (N = 5) or two (N > 5) reduction
+// levels into tasks and runs them on `threads` workers. Tasks are dealt
+// round-robin in program order, so every worker starts near the front;
+// a worker that runs dry steals from the back of another's deque.
+//
+// A hit lowers a shared bound on the program index, and every task and
+// every program past the bound is abandoned. The remaining work only
+// decides whether an earlier program also hits, so the result is the
+// handle solve() returns.
+// ---------------------------------------------------------------------------
+namespace detail {
+
+template <std::size_t N>
+struct SearchTask {
+  std::array<double, N> values;
+  uint64_t base;
+};
+
+template <std::size_t N>
+class TaskDeques {
+ public:
+  explicit TaskDeques(std::size_t workers) : deques_(workers) {}
+
+  void push(std::size_t worker, const SearchTask<N>& task) {
+    deques_[worker].tasks.push_back(task);
+  }
+
+  // The worker's own oldest task, else the newest task of another worker.
+  std::optional<SearchTask<N>> next(std::size_t worker) {
+    for (std::size_t k = 0; k < deques_.size(); ++k) {
+      auto& d = deques_[(worker + k) % deques_.size()];
+      std::lock_guard lock(d.mutex);
+      if (d.tasks.empty()) continue;
+      SearchTask<N> task;
+      if (k == 0) {
+        task = d.tasks.front();
+        d.tasks.pop_front();
+      } else {
+        task = d.tasks.back();
+        d.tasks.pop_back();
+      }
+      return task;
+    }
+    return std::nullopt;
+  }
+
+ private:
+  struct Deque {
+    std::mutex mutex;
+    std::deque<SearchTask<N>> tasks;
+  };
+  std::vector<Deque> deques_;
+};
+
+}  // namespace detail
+
+template <std::size_t N>
+SolutionHandle solve_parallel(const std::array<double, N>& a,
+                              double target = 24.0, std::size_t threads = 0) {
+  static_assert(N <= kMaxHandleInputs);
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  if constexpr (N <= kMaxInputs) {
+    return solve(a, target);
+  } else {
+    constexpr std::size_t kSplitLevels = N > 5 ? 2 : 1;
+    constexpr std::size_t kTaskItems = N - kSplitLevels;
+
+    detail::TaskDeques<N> deques(threads);
+    std::size_t dealt = 0;
+    detail::reduce(a, N, kTaskItems, 0,
+                   [&](const std::array<double, N>& values, uint64_t base) {
+                     deques.push(dealt++ % threads, {values, base});
+                     return false;
+                   });
+
+    std::atomic<uint64_t> bound = SolutionHandle::kNoProgram;
+    const auto work = [&](std::size_t worker) {
+      while (auto task = deques.next(worker)) {
+        if (task->base >= bound.load(std::memory_order_relaxed)) continue;
+        detail::enumerate(
+            task->values, kTaskItems, task->base,
+            [&](double v, uint64_t program) {
+              uint64_t current = bound.load(std::memory_order_relaxed);
+              if (program >= current) return true;
+              if (!(std::abs(v - target) < 1e-9)) return false;
+              while (program < current &&
+                     !bound.compare_exchange_weak(current, program)) {
+              }
+              return true;
+            });
+      }
+    };
+    {
+      std::vector<std::jthread> workers;
+      for (std::size_t w = 1; w < threads; ++w) workers.emplace_back(work, w);
+      work(0);
+    }
+
+    SolutionHandle h;
+    h.perm = identity_perm(N);
+    h.program = bound.load();
+    return h;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Reachable integer targets
+//
+// Evaluates the hand's programs once and records every integer in [lo, hi]
+// that some program reaches, optionally with the first handle (in search
+// order) for each, i.e. the one solve(a, target) would return. Stops early
+// once every target in the range is reached.
+// ---------------------------------------------------------------------------
+struct ReachableTargets {
+  int lo = 0;
+  int hi = -1;
+  std::vector<uint64_t> bits;            // bit t - lo set if t is reachable
+  std::vector<SolutionHandle> handles;   // handles[t - lo], when requested
+
+  bool contains(int t) const {
+    if (t < lo || t > hi) return false;
+    const std::size_t k = t - lo;
+    return bits[k / 64] >> (k % 64) & 1;
+  }
+  std::size_t count() const {
+    std::size_t n = 0;
+    for (uint64_t w : bits) n += std::popcount(w);
+    return n;
+  }
+};
+
+template <std::size_t N>
+ReachableTargets reachable_targets(const std::array<double, N>& a, int lo,
+                                   int hi, bool with_handles = false) {
+  static_assert(N <= kMaxHandleInputs);
+  ReachableTargets r;
+  r.lo = lo;
+  r.hi = hi;
+  if (hi < lo) return r;
+  const std::size_t width = static_cast<std::size_t>(hi - lo) + 1;
+  r.bits.assign((width + 63) / 64, 0);
+  if (with_handles) r.handles.assign(width, SolutionHandle{});
+
+  std::size_t missing = width;
+  // Returns true once every target is reached.
+  const auto visit = [&](double v, uint64_t program) {
+    const double t = std::round(v);
+    if (!(t >= lo && t <= hi) || std::abs(v - t) >= 1e-9) return false;
+    const std::size_t k = static_cast<std::size_t>(t - lo);
+    uint64_t& word = r.bits[k / 64];
+    const uint64_t bit = uint64_t{1} << (k % 64);
+    if (word & bit) return false;
+    word |= bit;
+    if (with_handles) {
+      r.handles[k].program = program;
+      r.handles[k].perm = identity_perm(N);
+    }
+    return --missing == 0;
+  };
+
+  if constexpr (N > kMaxInputs) {
+    detail::enumerate(a, N, 0, visit);
+  } else {
+    for (uint16_t p : detail::pruned_programs(a)) {
+      if (visit(eval_tree(kPrograms<N>[p], a.data()), p)) break;
+    }
+  }
+  return r;
+}
+
+// ---------------------------------------------------------------------------
+// Closest value
+//
+// For hands with no exact solution: the first program, in search order,
+// whose value is nearest to the target. An exact hit ends the search.
+//
+// Past kMaxInputs the runtime search is a branch-and-bound over reduced
+// multisets. Everything reachable from a multiset has been measured against
+// the best distance once it is explored, so a later branch that reduces to
+// the same multiset cannot improve on it and is cut. This is what makes it
+// much cheaper than scanning every program for N >= 5.
+// ---------------------------------------------------------------------------
+struct ClosestResult {
+  SolutionHandle handle;  // unsolved only if no program has a finite value
+  double value = std::numeric_limits<double>::quiet_NaN();
+};
+
+// ---------------------------------------------------------------------------
+// Bounded search
+//
+// solve_until() is closest() that gives up once the deadline passes or a
+// stop is requested, returning the best program found so far. Limits are
+// checked once per kLimitCheckPrograms table entries and, past kMaxInputs,
+// once per reduced multiset of at least kLimitCheckItems values, so a check
+// covers at most about a thousand evaluations.
+// ---------------------------------------------------------------------------
+struct SearchLimits {
+  std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::time_point::max();
+  std::stop_token stop;
+
+  bool reached() const {
+    return stop.stop_requested() ||
+           (deadline != std::chrono::steady_clock::time_point::max() &&
+            std::chrono::steady_clock::now() >= deadline);
+  }
+};
+
+struct BoundedResult {
+  ClosestResult best;
+  bool complete = true;  // false if the limits cut the search short
+};
+
+constexpr std::size_t kLimitCheckPrograms = 1024;
+constexpr std::size_t kLimitCheckItems = 3;
+
+namespace detail {
+
+template <std::size_t N>
+struct StateHash {
+  std::size_t operator()(const std::array<double, N>& s) const {
+    std::size_t h = 0;
+    for (double v : s) {
+      h = (h ^ std::bit_cast<uint64_t>(v)) * 0x100000001b3ULL;
+    }
+    return h;
+  }
+};
+
+template <std::size_t N>
+struct ClosestSearch {
+  double target;
+  const SearchLimits& limits;
+  bool stopped = false;
+  double best_distance = std::numeric_limits<double>::infinity();
+  double best_value = std::numeric_limits<double>::quiet_NaN();
+  uint64_t best_program = SolutionHandle::kNoProgram;
+  // Sorted multisets already explored, by size. Nodes come from an arena so
+  // that tearing down a large search is cheap.
+  std::pmr::monotonic_buffer_resource arena;
+  std::vector<std::pmr::unordered_set<std::array<double, N>, StateHash<N>>>
+      seen;
+
+  ClosestSearch(double target, const SearchLimits& limits)
+      : target(target), limits(limits) {
+    for (std::size_t n = 0; n <= N; ++n) seen.emplace_back(&arena);
+  }
+
+  // Returns true on an exact hit.
+  bool visit(double v, uint64_t program) {
+    const double d = std::abs(v - target);
+    if (d < best_distance) {
+      best_distance = d;
+      best_value = v;
+      best_program = program;
+    }
+    return d < 1e-9;
+  }
+
+  bool explore(const std::array<double, N>& values, std::size_t n,
+               uint64_t base) {
+    if (n == 1) return visit(values[0], base);
+    if (n >= kLimitCheckItems && limits.reached()) {
+      stopped = true;
+      return true;
+    }
+    if (n > 2) {
+      std::array<double, N> key{};
+      for (std::size_t k = 0; k < n; ++k) key[k] = values[k] + 0.0;  // -0
+      std::sort(key.begin(), key.begin() + n);
+      if (!seen[n].insert(key).second) return false;
+    }
+
+    const uint64_t stride = count_programs(n - 1);
+    uint64_t choice = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = i + 1; j < n; ++j, choice += kOpChoices) {
+        std::array<double, N> reduced{};
+        std::size_t ri = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+          if (k != i && k != j) reduced[ri++] = values[k];
+        }
+        for (std::size_t c = 0; c < kOpChoices; ++c) {
+          const auto& cop = kCombinedOps[c];
+          if (cop.swap && values[i] == values[j]) continue;
+          reduced[ri] = cop.swap ? apply_op(cop.op, values[j], values[i])
+                                 : apply_op(cop.op, values[i], values[j]);
+          // NaN stays NaN to the root.
+          if (std::isnan(reduced[ri])) continue;
+          if (explore(reduced, n - 1, base + (choice + c) * stride)) {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+};
+
+}  // namespace detail
+
+template <std::size_t N>
+BoundedResult solve_until(const std::array<double, N>& a,
+                          const SearchLimits& limits, double target = 24.0) {
+  static_assert(N <= kMaxHandleInputs);
+  BoundedResult result;
+  ClosestResult& r = result.best;
+  r.handle.perm = identity_perm(N);
+  if constexpr (N > kMaxInputs) {
+    detail::ClosestSearch<N> search{target, limits};
+    search.explore(a, N, 0);
+    result.complete = !search.stopped;
+    if (search.best_program != SolutionHandle::kNoProgram) {
+      r.handle.program = search.best_program;
+      r.value = search.best_value;
+    }
+  } else {
+    const auto& programs = detail::pruned_programs(a);
+    double best_distance = std::numeric_limits<double>::infinity();
+    for (std::size_t k = 0; k < programs.size(); ++k) {
+      if (k % kLimitCheckPrograms == 0 && limits.reached()) {
+        result.complete = false;
+        break;
+      }
+      const uint16_t p = programs[k];
+      const double v = eval_tree(kPrograms<N>[p], a.data());
+      const double d = std::abs(v - target);
+      if (d < best_distance) {
+        best_distance = d;
+        r.handle.program = p;
+        r.value = v;
+        if (d < 1e-9) break;
+      }
+    }
+  }
+  return result;
+}
+
+template <std::size_t N>
+ClosestResult closest(const std::array<double, N>& a, double target = 24.0) {
+  return solve_until(a, SearchLimits{}, target).best;
+}
+
+// ---------------------------------------------------------------------------
+// Public API — matches the original calc24() signature, plus a runtime
+// target.
+// ---------------------------------------------------------------------------
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N>& a,
+                                  double target) {
+  const SolutionHandle h = solve(a, target);
+  if (!h.solved()) return std::nullopt;
+  return format(h, a);
+}
+
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N>& a) {
+  return calc24(a, 24.0);
+}
+
+// ---------------------------------------------------------------------------
+// Incremental re-solve
+//
+// IncrementalSolver keeps, for every proper subset of the inputs, the
+// distinct finite values its expressions can reach, sorted, with a back
+// reference to the split and op that first produced each one. The full set
+// is never materialised: a solution is a split (A, B) of all inputs and a
+// value of A for which the matching value of B is looked up.
+//
+// replace(i, v) keeps every subset without input i. Subsets with it are
+// rebuilt eagerly up to two inputs and otherwise only when a split needs
+// them, after the splits over cached subsets have been tried, so a one-card
+// change to a solvable hand rarely rebuilds the large ones. The expression
+// found may differ from the one calc24() returns for the hand.
+// ---------------------------------------------------------------------------
+constexpr std::size_t kMaxIncrementalInputs = 6;
+
+template <std::size_t N>
+class IncrementalSolver {
+  static_assert(N >= 1 && N <= kMaxIncrementalInputs);
+
+ public:
+  explicit IncrementalSolver(const std::array<double, N>& hand) : hand_(hand) {
+    for (std::size_t s = 1; s < kFull; ++s) invalidate(s);
+    find();
+  }
+
+  const std::array<double, N>& hand() const { return hand_; }
+  bool solved() const { return found_.has_value(); }
+
+  // Replace input i with `value` and re-solve.
+  void replace(std::size_t i, double value) {
+    hand_[i] = value;
+    for (std::size_t s = 1; s < kFull; ++s) {
+      if (s >> i & 1) invalidate(s);
+    }
+    find();
+  }
+
+  std::optional<std::string> solution() const {
+    if (!found_) return std::nullopt;
+    if constexpr (N == 1) {
+      return detail::print_leaf(hand_[0]).text;
+    } else {
+      const Entry& top = *found_;
+      return combine(top.op, print(top.left, top.left_idx),
+                     print(kFull ^ top.left, top.right_idx))
+          .text;
+    }
+  }
+
+ private:
+  static constexpr std::size_t kFull = (std::size_t{1} << N) - 1;
+
+  // A value of a subset made by kCombinedOps[op] from value left_idx of
+  // subset `left` and value right_idx of the rest of the subset.
+  struct Entry {
+    double value = 0;
+    uint32_t left_idx = 0;
+    uint32_t right_idx = 0;
+    uint8_t left = 0;
+    uint8_t op = 0;
+  };
+
+  static bool is_24(double v) { return std::abs(v - 24.0) < 1e-9; }
+
+  static double apply(uint8_t c, double a, double b) {
+    const auto& cop = detail::kCombinedOps[c];
+    return cop.swap ? apply_op(cop.op, b, a) : apply_op(cop.op, a, b);
+  }
+
+  static detail::PrintResult combine(uint8_t c, const detail::PrintResult& a,
+                                     const detail::PrintResult& b) {
+    const auto& cop = detail::kCombinedOps[c];
+    return cop.swap ? detail::print_op(cop.op, b, a)
+                    : detail::print_op(cop.op, a, b);
+  }
+
+  // Value of B that kCombinedOps[c] would need to pair with a to give 24.
+  static std::optional<double> needed(uint8_t c, double a) {
+    switch (c) {
+      case 0: return 24.0 - a;  // a + b
+      case 1: return a - 24.0;  // a - b
+      case 2: return 24.0 + a;  // b - a
+      case 3: return a == 0 ? std::nullopt : std::optional(24.0 / a);
+      case 4: return a == 0 ? std::nullopt : std::optional(a / 24.0);
+      case 5: return 24.0 * a;  // b / a
+    }
+    return std::nullopt;
+  }
+
+  // Splits (A, S ^ A) of s with the lowest input of s in A, each once.
+  template <typename F>
+  static void for_each_split(std::size_t s, F&& f) {
+    const std::size_t low = s & -s;
+    for (std::size_t a = (s - 1) & s; a != 0; a = (a - 1) & s) {
+      if (a & low) f(a, s ^ a);
+    }
+  }
+
+  void invalidate(std::size_t s) {
+    if (std::popcount(s) <= 2) {
+      stale_[s] = false;
+      build(s);
+    } else {
+      stale_[s] = true;
+    }
+  }
+
+  const std::vector<Entry>& values(std::size_t s) {
+    if (stale_[s]) {
+      stale_[s] = false;
+      build(s);
+    }
+    return values_[s];
+  }
+
+  void build(std::size_t s) {
+    auto& out = values_[s];
+    out.clear();
+    if (std::popcount(s) == 1) {
+      out.push_back({hand_[std::countr_zero(s)]});
+      return;
+    }
+    for_each_split(s, [&](std::size_t a, std::size_t b) {
+      const auto& va = values(a);
+      const auto& vb = values(b);
+      for (uint32_t ia = 0; ia < va.size(); ++ia) {
+        for (uint32_t ib = 0; ib < vb.size(); ++ib) {
+          for (uint8_t c = 0; c < detail::kOpChoices; ++c) {
+            const double v = apply(c, va[ia].value, vb[ib].value);
+            if (std::isfinite(v)) {
+              out.push_back({v, ia, ib, static_cast<uint8_t>(a), c});
+            }
+          }
+        }
+      }
+    });
+    // Keep the first way of reaching each value.
+    std::stable_sort(out.begin(), out.end(),
+                     [](const Entry& x, const Entry& y) {
+                       return x.value < y.value;
+                     });
+    out.erase(std::unique(out.begin(), out.end(),
+                          [](const Entry& x, const Entry& y) {
+                            return x.value == y.value;
+                          }),
+              out.end());
+  }
+
+  // Look for a value of A and a value of B combining to 24.
+  void search_split(std::size_t a, std::size_t b) {
+    const auto& va = values(a);
+    const auto& vb = values(b);
+    for (uint32_t ia = 0; ia < va.size(); ++ia) {
+      for (uint8_t c = 0; c < detail::kOpChoices; ++c) {
+        const auto want = needed(c, va[ia].value);
+        if (!want) continue;
+        // The inverse is only approximate; confirm candidates forward.
+        const double slack = 1e-6 * std::max(1.0, std::abs(*want));
+        auto it = std::lower_bound(
+            vb.begin(), vb.end(), *want - slack,
+            [](const Entry& e, double v) { return e.value < v; });
+        for (; it != vb.end() && it->value <= *want + slack; ++it) {
+          if (is_24(apply(c, va[ia].value, it->value))) {
+            found_ = Entry{24.0, ia, static_cast<uint32_t>(it - vb.begin()),
+                           static_cast<uint8_t>(a), c};
+            return;
+          }
+        }
+      }
+    }
+  }
+
+  void find() {
+    found_.reset();
+    if constexpr (N == 1) {
+      if (is_24(hand_[0])) found_ = Entry{hand_[0]};
+    } else {
+      // Splits over cached subsets first, then the ones that rebuild.
+      const auto stale = stale_;
+      for (bool cached : {true, false}) {
+        for_each_split(kFull, [&](std::size_t a, std::size_t b) {
+          if (found_ || cached == (stale[a] || stale[b])) return;
+          search_split(a, b);
+        });
+      }
+    }
+  }
+
+  detail::PrintResult print(std::size_t s, uint32_t idx) const {
+    const Entry& e = values_[s][idx];
+    if (std::popcount(s) == 1) return detail::print_leaf(e.value);
+    return combine(e.op, print(e.left, e.left_idx),
+                   print(s ^ e.left, e.right_idx));
+  }
+
+  std::array<double, N> hand_;
+  std::array<std::vector<Entry>, kFull> values_;
+  std::array<bool, kFull> stale_{};
+  std::optional<Entry> found_;
+};
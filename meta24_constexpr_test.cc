@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 TEST(Calc24ConstexprTest, Basic3Numbers) {
   const auto result = calc24(std::array<double, 3>{2, 3, 4});
   EXPECT_TRUE(result.has_value());
@@ -22,3 +24,200 @@ TEST(Calc24ConstexprTest, FractionalCalc) {
   const auto result = calc24(std::array<double, 4>{3, 3, 7, 7});
   EXPECT_TRUE(result.has_value());
 }
+
+TEST(Calc24ConstexprTest, PruningSkipsRepeatedInputs) {
+  const auto distinct =
+      detail::pruned_programs(std::array<double, 4>{1, 2, 3, 4}).size();
+  const auto pairs =
+      detail::pruned_programs(std::array<double, 4>{3, 3, 7, 7}).size();
+  const auto same =
+      detail::pruned_programs(std::array<double, 4>{6, 6, 6, 6}).size();
+  EXPECT_LT(distinct, count_programs(4));
+  EXPECT_LT(pairs, distinct);
+  EXPECT_LT(same, pairs);
+}
+
+// Pruning must not change which solution is found first.
+TEST(Calc24ConstexprTest, PruningMatchesFullScan) {
+  std::array<double, 4> a;
+  for (int h = 0; h < 6 * 6 * 6 * 6; ++h) {
+    for (int i = 0, rest = h; i < 4; ++i, rest /= 6) a[i] = rest % 6 + 1;
+    std::optional<std::string> expected;
+    for (uint16_t p : detail::program_order<4>()) {
+      const auto& tree = kPrograms<4>[p];
+      if (std::abs(eval_tree(tree, a.data()) - 24.0) < 1e-9) {
+        expected = print_tree(tree, a);
+        break;
+      }
+    }
+    EXPECT_EQ(calc24(a), expected);
+  }
+}
+
+// The runtime search must number programs exactly like the table.
+TEST(Calc24ConstexprTest, SearchMatchesProgramTable) {
+  const std::array<double, 4> hand{1, 5, 7, 10};
+  for (std::size_t p = 0; p < kPrograms<4>.size(); ++p) {
+    ASSERT_EQ(detail::format_program(p, hand),
+              print_tree(kPrograms<4>[p], hand));
+  }
+
+  std::array<double, 4> a;
+  for (int h = 0; h < 6 * 6 * 6 * 6; ++h) {
+    for (int i = 0, rest = h; i < 4; ++i, rest /= 6) a[i] = rest % 6 + 1;
+    uint64_t expected = 0;
+    for (; expected < kPrograms<4>.size(); ++expected) {
+      const double v = eval_tree(kPrograms<4>[expected], a.data());
+      if (std::abs(v - 24.0) < 1e-9) break;
+    }
+    uint64_t found = 0;
+    const bool hit = detail::search(a, 4, 0, found);
+    ASSERT_EQ(hit, expected < kPrograms<4>.size());
+    if (hit) {
+      EXPECT_EQ(found, expected);
+    }
+  }
+}
+
+TEST(Calc24ConstexprTest, Basic5Numbers) {
+  EXPECT_TRUE(calc24(std::array<double, 5>{1, 2, 3, 4, 5}).has_value());
+  EXPECT_FALSE(calc24(std::array<double, 5>{1, 1, 1, 1, 1}).has_value());
+}
+
+TEST(Calc24ConstexprTest, BatchHandles) {
+  const std::array<std::array<double, 4>, 4> hands{{
+      {1, 2, 3, 4}, {1, 1, 1, 1}, {3, 3, 7, 7}, {13, 13, 13, 13}}};
+  std::array<SolutionHandle, 4> out;
+  EXPECT_EQ(calc24_batch<4>(hands, out), 2u);
+  for (std::size_t i = 0; i < hands.size(); ++i) {
+    const auto expected = calc24(hands[i]);
+    ASSERT_EQ(out[i].solved(), expected.has_value());
+    if (out[i].solved()) {
+      EXPECT_EQ(format(out[i], hands[i]), *expected);
+    }
+  }
+}
+
+TEST(Calc24ConstexprTest, HandlePermutation) {
+  const std::array<double, 5> hand{1, 2, 3, 4, 5};
+  SolutionHandle h = solve(hand);
+  ASSERT_TRUE(h.solved());
+
+  // The same program over a shuffled hand, with the shuffle in the handle.
+  const std::array<double, 5> shuffled{4, 1, 5, 3, 2};
+  const std::array<std::size_t, 5> from{1, 4, 3, 0, 2};
+  h.perm = 0;
+  for (std::size_t k = 0; k < 5; ++k) h.perm |= from[k] << (3 * k);
+  EXPECT_EQ(format(h, shuffled), *calc24(hand));
+}
+
+// Replacing one input must give the same answer as solving the new hand.
+TEST(Calc24ConstexprTest, IncrementalReplace) {
+  IncrementalSolver<4> solver(std::array<double, 4>{1, 1, 1, 1});
+  EXPECT_FALSE(solver.solved());
+  std::mt19937 rng(4);
+  std::uniform_int_distribution<int> card(1, 13);
+  std::uniform_int_distribution<std::size_t> slot(0, 3);
+  for (int step = 0; step < 2000; ++step) {
+    solver.replace(slot(rng), card(rng));
+    ASSERT_EQ(solver.solved(), calc24(solver.hand()).has_value());
+    EXPECT_EQ(solver.solution().has_value(), solver.solved());
+  }
+}
+
+TEST(Calc24ConstexprTest, RuntimeTarget) {
+  EXPECT_TRUE(calc24(std::array<double, 3>{1, 1, 1}, 3).has_value());
+  EXPECT_FALSE(calc24(std::array<double, 3>{1, 1, 1}, 4).has_value());
+  EXPECT_TRUE(calc24(std::array<double, 5>{1, 2, 3, 4, 5}, 100).has_value());
+}
+
+// One pass must agree with calc24 run once per target.
+TEST(Calc24ConstexprTest, ReachableTargets) {
+  const std::array<std::array<double, 4>, 3> hands{{
+      {1, 2, 3, 4}, {1, 1, 1, 1}, {3, 3, 8, 8}}};
+  for (const auto& hand : hands) {
+    const auto r = reachable_targets(hand, -10, 100, true);
+    for (int t = -10; t <= 100; ++t) {
+      const auto expected = calc24(hand, t);
+      ASSERT_EQ(r.contains(t), expected.has_value()) << t;
+      if (expected) {
+        EXPECT_EQ(format(r.handles[t + 10], hand), *expected);
+      }
+    }
+  }
+
+  const auto five = reachable_targets(std::array<double, 5>{1, 1, 1, 1, 1},
+                                      1, 10);
+  EXPECT_EQ(five.count(), 6u);  // 1..6
+  EXPECT_TRUE(five.contains(6));
+  EXPECT_FALSE(five.contains(7));
+}
+
+// Branch-and-bound must find the same program as a full scan.
+TEST(Calc24ConstexprTest, ClosestMatchesFullScan) {
+  const std::array<std::array<double, 5>, 3> hands{{
+      {1, 1, 1, 1, 1}, {2, 3, 5, 7, 11}, {13, 13, 1, 1, 2}}};
+  for (const auto& hand : hands) {
+    for (double target : {24.0, 1000.0, 0.3}) {
+      double best = std::numeric_limits<double>::infinity();
+      uint64_t program = 0;
+      detail::enumerate(hand, 5, 0, [&](double v, uint64_t p) {
+        if (std::abs(v - target) < best) {
+          best = std::abs(v - target);
+          program = p;
+        }
+        return best < 1e-9;
+      });
+      const ClosestResult r = closest(hand, target);
+      ASSERT_TRUE(r.handle.solved());
+      EXPECT_EQ(r.handle.program, program) << target;
+      EXPECT_EQ(std::abs(r.value - target), best) << target;
+    }
+  }
+
+  const auto four = closest(std::array<double, 4>{1, 1, 1, 1});
+  EXPECT_EQ(four.value, 4);
+  EXPECT_EQ(format(four.handle, std::array<double, 4>{1, 1, 1, 1}),
+            "1 + 1 + 1 + 1");
+  EXPECT_EQ(closest(std::array<double, 4>{3, 3, 7, 7}).handle.program,
+            solve(std::array<double, 4>{3, 3, 7, 7}).program);
+}
+
+TEST(Calc24ConstexprTest, SolveUntilLimits) {
+  const std::array<double, 6> hand{1, 1, 1, 1, 1, 1};
+
+  std::stop_source source;
+  source.request_stop();
+  const BoundedResult cancelled = solve_until(hand, {.stop = source.get_token()});
+  EXPECT_FALSE(cancelled.complete);
+  EXPECT_FALSE(cancelled.best.handle.solved());
+
+  const BoundedResult expired =
+      solve_until(hand, {.deadline = std::chrono::steady_clock::now()});
+  EXPECT_FALSE(expired.complete);
+
+  // Unlimited runs to completion and agrees with closest().
+  const BoundedResult full = solve_until(hand, {});
+  EXPECT_TRUE(full.complete);
+  EXPECT_EQ(full.best.value, 9);  // (1 + 1 + 1) * (1 + 1 + 1)
+  EXPECT_EQ(full.best.handle.program, closest(hand).handle.program);
+
+  const auto four = solve_until(std::array<double, 4>{1, 1, 1, 1},
+                                {.stop = source.get_token()});
+  EXPECT_FALSE(four.complete);
+}
+
+// Workers must agree on the first program in order, hit or not.
+TEST(Calc24ConstexprTest, ParallelMatchesSerial) {
+  const std::array<std::array<double, 5>, 3> fives{{
+      {1, 2, 3, 4, 5}, {1, 1, 1, 1, 1}, {13, 11, 7, 5, 1}}};
+  for (const auto& hand : fives) {
+    for (std::size_t threads : {1, 3, 8}) {
+      EXPECT_EQ(solve_parallel(hand, 24.0, threads).program,
+                solve(hand).program);
+    }
+  }
+  const std::array<double, 6> six{1, 1, 1, 1, 1, 2};
+  EXPECT_EQ(solve_parallel(six, 24.0, 4).program, solve(six).program);
+  EXPECT_EQ(solve_parallel(six, 1000.0, 4).program, solve(six, 1000).program);
+}
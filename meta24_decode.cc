@@ -0,0 +1,73 @@
+#include "meta24_stream.h"
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// ============================================================================
+// meta24_decode — render a result stream (meta24_stream.h) as the drivers'
+// text output, one "a, b, c, d -> expression" line per hand.
+//
+//   meta24_decode [STREAM]
+//
+// Reads standard input without STREAM. Fails on a malformed or truncated
+// stream, after printing the records read so far.
+// ============================================================================
+
+namespace {
+
+template <std::size_t N>
+void decode(result_stream::Reader& reader, std::ostream& out) {
+  result_stream::Record record;
+  std::string line;
+  while (reader.next(record)) {
+    line.clear();
+    for (std::size_t j = 0; j < N; j++) {
+      if (j > 0) line.append(", ");
+      line.append(std::to_string(record.hand[j]));
+    }
+    line.append(" -> ");
+    if (record.status == result_stream::kSolved) {
+      line.append(format(record.handle, record.values<N>()));
+    } else {
+      line.append("No Solution");
+    }
+    line.push_back('\n');
+    out << line;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 2) {
+    std::cerr << "usage: meta24_decode [STREAM]" << std::endl;
+    return 2;
+  }
+  std::ifstream file;
+  if (argc == 2) file.open(argv[1], std::ios::binary);
+  std::istream& in = argc == 2 ? file : std::cin;
+
+  result_stream::Reader reader(in);
+  if (!reader.valid()) {
+    std::cerr << "not a result stream" << std::endl;
+    return 1;
+  }
+  switch (reader.n()) {
+    case 1: decode<1>(reader, std::cout); break;
+    case 2: decode<2>(reader, std::cout); break;
+    case 3: decode<3>(reader, std::cout); break;
+    case 4: decode<4>(reader, std::cout); break;
+    case 5: decode<5>(reader, std::cout); break;
+    case 6: decode<6>(reader, std::cout); break;
+    case 7: decode<7>(reader, std::cout); break;
+    case 8: decode<8>(reader, std::cout); break;
+  }
+  std::cout.flush();
+  if (!reader.complete()) {
+    std::cerr << "truncated result stream" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,300 @@
+#include "meta24_prebuilt.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Differential fuzzing of calc24.
+//
+// The same source is built once per backend (META24_BACKEND names it, see the
+// meta24_*_fuzz_test targets) and checks that backend against an exact
+// rational reference solver on a fixed, seeded stream of hands. Every backend
+// agreeing with the reference is what makes them agree with each other.
+//
+// Each returned expression is re-parsed and evaluated exactly: it must use
+// the hand's numbers exactly once each and equal 24.
+//
+// The timing test fails when ns/puzzle exceeds the backend's entry in
+// meta24_fuzz_baseline.txt by more than META24_PERF_SLACK (default 3x).
+// ============================================================================
+
+#define META24_STR(x) #x
+#define META24_XSTR(x) META24_STR(x)
+
+namespace {
+
+constexpr char kBackend[] = META24_XSTR(META24_BACKEND);
+
+// ---------------------------------------------------------------------------
+// Exact arithmetic
+// ---------------------------------------------------------------------------
+struct Rational {
+  __int128 num = 0;
+  __int128 den = 1;
+};
+
+__int128 gcd(__int128 a, __int128 b) {
+  if (a < 0) a = -a;
+  if (b < 0) b = -b;
+  while (b != 0) {
+    const __int128 t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+Rational normalize(__int128 num, __int128 den) {
+  if (den < 0) {
+    num = -num;
+    den = -den;
+  }
+  const __int128 g = gcd(num, den);
+  return g > 1 ? Rational{num / g, den / g} : Rational{num, den};
+}
+
+// Returns nothing for a division by zero.
+std::optional<Rational> apply(char op, const Rational& a, const Rational& b) {
+  switch (op) {
+    case '+': return normalize(a.num * b.den + b.num * a.den, a.den * b.den);
+    case '-': return normalize(a.num * b.den - b.num * a.den, a.den * b.den);
+    case '*': return normalize(a.num * b.num, a.den * b.den);
+    default:
+      if (b.num == 0) return std::nullopt;
+      return normalize(a.num * b.den, a.den * b.num);
+  }
+}
+
+bool is_24(const Rational& r) { return r.num == 24 && r.den == 1; }
+
+// Reference solver: every pair reduction over exact values.
+bool solvable(std::vector<Rational> items) {
+  if (items.size() == 1) return is_24(items[0]);
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    for (std::size_t j = i + 1; j < items.size(); ++j) {
+      std::vector<Rational> reduced;
+      for (std::size_t k = 0; k < items.size(); ++k) {
+        if (k != i && k != j) reduced.push_back(items[k]);
+      }
+      reduced.emplace_back();
+      for (const auto& [op, swap] :
+           {std::pair{'+', false}, {'-', false}, {'-', true}, {'*', false},
+            {'/', false}, {'/', true}}) {
+        const auto r = swap ? apply(op, items[j], items[i])
+                            : apply(op, items[i], items[j]);
+        if (!r) continue;
+        reduced.back() = *r;
+        if (solvable(reduced)) return true;
+      }
+    }
+  }
+  return false;
+}
+
+// ---------------------------------------------------------------------------
+// Exact expression evaluation
+// ---------------------------------------------------------------------------
+class Parser {
+ public:
+  explicit Parser(const std::string& text) : text_(text) {}
+
+  // Evaluates the whole expression, collecting its literals. Returns nothing
+  // on a syntax error or a division by zero.
+  std::optional<Rational> parse(std::vector<int64_t>& literals) {
+    literals_ = &literals;
+    auto r = sum();
+    skip_spaces();
+    if (pos_ != text_.size()) return std::nullopt;
+    return r;
+  }
+
+ private:
+  void skip_spaces() {
+    while (pos_ < text_.size() && text_[pos_] == ' ') ++pos_;
+  }
+
+  bool eat(char c) {
+    skip_spaces();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  std::optional<Rational> sum() {
+    auto r = product();
+    while (r) {
+      if (eat('+')) {
+        auto b = product();
+        r = b ? apply('+', *r, *b) : std::nullopt;
+      } else if (eat('-')) {
+        auto b = product();
+        r = b ? apply('-', *r, *b) : std::nullopt;
+      } else {
+        break;
+      }
+    }
+    return r;
+  }
+
+  std::optional<Rational> product() {
+    auto r = atom();
+    while (r) {
+      if (eat('*')) {
+        auto b = atom();
+        r = b ? apply('*', *r, *b) : std::nullopt;
+      } else if (eat('/')) {
+        auto b = atom();
+        r = b ? apply('/', *r, *b) : std::nullopt;
+      } else {
+        break;
+      }
+    }
+    return r;
+  }
+
+  std::optional<Rational> atom() {
+    if (eat('(')) {
+      auto r = sum();
+      if (!eat(')')) return std::nullopt;
+      return r;
+    }
+    skip_spaces();
+    const std::size_t start = pos_;
+    int64_t value = 0;
+    while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+      value = value * 10 + (text_[pos_++] - '0');
+    }
+    if (pos_ == start) return std::nullopt;
+    literals_->push_back(value);
+    return Rational{value, 1};
+  }
+
+  const std::string& text_;
+  std::size_t pos_ = 0;
+  std::vector<int64_t>* literals_ = nullptr;
+};
+
+// ---------------------------------------------------------------------------
+// Hand generation
+// ---------------------------------------------------------------------------
+template <std::size_t N>
+std::vector<std::array<double, N>> fuzz_hands(std::size_t random_count) {
+  std::vector<std::array<double, N>> hands;
+  std::mt19937 rng(24);
+
+  // Edge cases: every hand over values that exercise zeros, identities,
+  // 24 itself and fractional intermediates (3,3,8,8 needs 8/3).
+  constexpr int kEdge[] = {0, 1, 2, 3, 5, 7, 8, 12, 24};
+  constexpr std::size_t kEdgeCount = std::size(kEdge);
+  std::size_t total = 1;
+  for (std::size_t i = 0; i < N; ++i) total *= kEdgeCount;
+  for (std::size_t h = 0; h < total; ++h) {
+    std::array<double, N> a;
+    for (std::size_t i = 0, rest = h; i < N; ++i, rest /= kEdgeCount) {
+      a[i] = kEdge[rest % kEdgeCount];
+    }
+    hands.push_back(a);
+  }
+
+  // Random hands: mostly 1..13, some with zeros or large values.
+  std::uniform_int_distribution<int> card(1, 13);
+  std::uniform_int_distribution<int> large(14, 500);
+  std::uniform_int_distribution<int> kind(0, 9);
+  for (std::size_t h = 0; h < random_count; ++h) {
+    std::array<double, N> a;
+    for (auto& x : a) {
+      const int k = kind(rng);
+      x = k == 0 ? 0 : k == 1 ? large(rng) : card(rng);
+    }
+    hands.push_back(a);
+  }
+  return hands;
+}
+
+template <std::size_t N>
+void check_against_reference(std::size_t random_count) {
+  for (const auto& a : fuzz_hands<N>(random_count)) {
+    std::vector<Rational> items;
+    std::vector<int64_t> numbers;
+    for (double x : a) {
+      items.push_back({static_cast<int64_t>(x), 1});
+      numbers.push_back(static_cast<int64_t>(x));
+    }
+    const auto result = calc24(a);
+    ASSERT_EQ(result.has_value(), solvable(items))
+        << kBackend << " disagrees with the reference on "
+        << ::testing::PrintToString(a);
+    if (!result) continue;
+
+    std::vector<int64_t> literals;
+    const auto value = Parser(*result).parse(literals);
+    ASSERT_TRUE(value.has_value())
+        << *result << " does not evaluate exactly for "
+        << ::testing::PrintToString(a);
+    EXPECT_TRUE(is_24(*value)) << *result;
+    std::sort(literals.begin(), literals.end());
+    std::sort(numbers.begin(), numbers.end());
+    EXPECT_EQ(literals, numbers) << *result;
+  }
+}
+
+std::optional<double> baseline_ns_per_puzzle() {
+  std::ifstream in("meta24_fuzz_baseline.txt");
+  std::string name;
+  double ns;
+  while (in >> name) {
+    if (name[0] == '#') {
+      std::getline(in, name);
+      continue;
+    }
+    if (in >> ns && name == kBackend) return ns;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+TEST(Calc24FuzzTest, Agrees2Numbers) { check_against_reference<2>(2000); }
+
+TEST(Calc24FuzzTest, Agrees3Numbers) { check_against_reference<3>(5000); }
+
+TEST(Calc24FuzzTest, Agrees4Numbers) { check_against_reference<4>(20000); }
+
+// ns/puzzle over the drivers' distribution: 4 values in 1..13.
+TEST(Calc24FuzzTest, NoPerformanceRegression) {
+  const auto baseline = baseline_ns_per_puzzle();
+  if (!baseline) GTEST_SKIP() << "no baseline for " << kBackend;
+  const char* slack_env = std::getenv("META24_PERF_SLACK");
+  const double slack = slack_env ? std::atof(slack_env) : 3.0;
+
+  std::mt19937 rng(123);
+  std::uniform_int_distribution<int> card(1, 13);
+  std::vector<std::array<double, 4>> hands(20000);
+  for (auto& a : hands) {
+    for (auto& x : a) x = card(rng);
+  }
+
+  std::size_t solved = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& a : hands) solved += calc24(a).has_value();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const double ns =
+      std::chrono::duration<double, std::nano>(elapsed).count() / hands.size();
+
+  RecordProperty("ns_per_puzzle", std::to_string(ns));
+  EXPECT_GT(solved, 0u);
+  EXPECT_LE(ns, *baseline * slack)
+      << kBackend << " takes " << ns << " ns/puzzle, baseline " << *baseline;
+}
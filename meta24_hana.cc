@@ -1,4 +1,4 @@
-#include "meta24_hana.h"
+#include "meta24_prebuilt.h"
 
 #include <array>
 #include <iostream>
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <iostream>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -272,10 +274,11 @@ struct Build<L, std::enable_if_t<(
 //
 // Expression types are generated entirely at compile time as a
 // hana::tuple of hana::type<Expr>.  At runtime we iterate over them
-// with hana::for_each to find one evaluating to 24.
+// with hana::for_each to find one evaluating to `target` (24 by default).
 // ---------------------------------------------------------------------------
 template <std::size_t N>
-std::optional<std::string> calc24(const std::array<double, N>& a) {
+std::optional<std::string> calc24(const std::array<double, N>& a,
+                                  double target) {
   // Build initial Values: hana::tuple<hana::type<Value<size_t<0>>>, ...>
   using Values = detail::MakeValues<N>;
 
@@ -286,9 +289,14 @@ std::optional<std::string> calc24(const std::array<double, N>& a) {
   hana::for_each(Exprs{}, [&](auto expr_type) {
     if (result.has_value()) return;
     using E = typename decltype(expr_type)::type;
-    if (E::eval(a) == 24) {
+    if (std::abs(E::eval(a) - target) < 1e-9) {
       result = E::print(a);
     }
   });
   return result;
 }
+
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N>& a) {
+  return calc24(a, 24.0);
+}
@@ -1,4 +1,4 @@
-#include "meta24_hana.h"
+#include "meta24_prebuilt.h"
 
 #include <gtest/gtest.h>
 
@@ -22,3 +22,8 @@ TEST(Calc24HanaTest, FractionalCalc) {
   const auto result = calc24(std::array<double, 4>{3, 3, 7, 7});
   EXPECT_TRUE(result.has_value());
 }
+
+TEST(Calc24HanaTest, RuntimeTarget) {
+  EXPECT_TRUE(calc24(std::array<double, 3>{1, 1, 1}, 3).has_value());
+  EXPECT_FALSE(calc24(std::array<double, 3>{1, 1, 1}, 4).has_value());
+}
@@ -0,0 +1,14 @@
+#include "meta24_prebuilt.h"
+
+#include "meta24.h"
+
+// Explicit instantiations backing meta24_prebuilt.h.
+template std::optional<std::string> calc24<2>(const std::array<double, 2>& a,
+                                             double target);
+template std::optional<std::string> calc24<3>(const std::array<double, 3>& a,
+                                             double target);
+template std::optional<std::string> calc24<4>(const std::array<double, 4>& a,
+                                             double target);
+template std::optional<std::string> calc24<2>(const std::array<double, 2>& a);
+template std::optional<std::string> calc24<3>(const std::array<double, 3>& a);
+template std::optional<std::string> calc24<4>(const std::array<double, 4>& a);
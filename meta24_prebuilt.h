@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+// ============================================================================
+// meta24_prebuilt.h — calc24() without the template machinery.
+//
+// Every backend exposes the same calc24<N>. Including this header instead of
+// a backend header leaves the expression-tree expansion to one prebuilt
+// library per backend, which explicitly instantiates N = 2..4:
+//
+//   meta24_prebuilt            Boost.Mp11 (meta24.h)
+//   meta24_hana_prebuilt       Boost.Hana (meta24_hana.h)
+//   meta24_constexpr_prebuilt  C++20 constexpr (meta24_constexpr.h)
+//
+// Link exactly one of them. Other N still need the backend header.
+// ============================================================================
+
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N>& a,
+                                  double target);
+template <std::size_t N>
+std::optional<std::string> calc24(const std::array<double, N>& a);
+
+extern template std::optional<std::string> calc24<2>(
+    const std::array<double, 2>& a, double target);
+extern template std::optional<std::string> calc24<3>(
+    const std::array<double, 3>& a, double target);
+extern template std::optional<std::string> calc24<4>(
+    const std::array<double, 4>& a, double target);
+extern template std::optional<std::string> calc24<2>(
+    const std::array<double, 2>& a);
+extern template std::optional<std::string> calc24<3>(
+    const std::array<double, 3>& a);
+extern template std::optional<std::string> calc24<4>(
+    const std::array<double, 4>& a);
@@ -0,0 +1,180 @@
+#include "meta24_constexpr.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// meta24_profile — profile-guided ordering of the program tables.
+//
+// Every hand of N values in 1..13 (the drivers' distribution) is solved
+// against the whole table to find which programs solve it. Programs are then
+// ordered greedily: the one solving the most not-yet-covered hands first,
+// then the rest by how many hands they solve. For each N the tool reports
+// the mean number of trees calc24 evaluates per solvable hand under generate
+// order, the checked-in order, and the new order.
+//
+//   meta24_profile [OUT]
+//
+// With OUT, also writes the new orders as a replacement for
+// meta24_program_order.h.
+// ============================================================================
+
+namespace {
+
+constexpr int kMaxValue = 13;
+
+template <std::size_t N>
+std::vector<std::array<double, N>> corpus() {
+  std::vector<std::array<double, N>> hands;
+  std::array<double, N> a;
+  std::size_t total = 1;
+  for (std::size_t i = 0; i < N; ++i) total *= kMaxValue;
+  for (std::size_t h = 0; h < total; ++h) {
+    for (std::size_t i = 0, rest = h; i < N; ++i, rest /= kMaxValue) {
+      a[i] = rest % kMaxValue + 1;
+    }
+    hands.push_back(a);
+  }
+  return hands;
+}
+
+bool hits(const ExprTree& tree, const double* inputs) {
+  return std::abs(eval_tree(tree, inputs) - 24.0) < 1e-9;
+}
+
+// Mean trees evaluated per solvable hand when tables are built from `order`.
+template <std::size_t N>
+double mean_evaluated(const std::vector<std::array<double, N>>& hands,
+                      std::span<const uint16_t> order) {
+  const auto tables = detail::build_pruned_tables<N>(order);
+  uint64_t evaluated = 0;
+  uint64_t solvable = 0;
+  for (const auto& a : hands) {
+    const auto& programs = tables[detail::pattern_of(a)];
+    for (std::size_t k = 0; k < programs.size(); ++k) {
+      if (hits(kPrograms<N>[programs[k]], a.data())) {
+        evaluated += k + 1;
+        ++solvable;
+        break;
+      }
+    }
+  }
+  return static_cast<double>(evaluated) / solvable;
+}
+
+template <std::size_t N>
+std::vector<uint16_t> profile(const std::vector<std::array<double, N>>& hands) {
+  constexpr std::size_t kCount = count_programs(N);
+
+  // solvers[h]: programs solving hand h; solved[p]: hands program p solves.
+  std::vector<std::vector<uint16_t>> solvers(hands.size());
+  std::vector<std::vector<uint32_t>> solved(kCount);
+  for (std::size_t h = 0; h < hands.size(); ++h) {
+    for (std::size_t p = 0; p < kCount; ++p) {
+      if (hits(kPrograms<N>[p], hands[h].data())) {
+        solvers[h].push_back(static_cast<uint16_t>(p));
+        solved[p].push_back(static_cast<uint32_t>(h));
+      }
+    }
+  }
+
+  std::vector<std::size_t> uncovered(kCount);
+  for (std::size_t p = 0; p < kCount; ++p) uncovered[p] = solved[p].size();
+  std::vector<bool> covered(hands.size());
+  std::vector<bool> placed(kCount);
+  std::vector<uint16_t> order;
+
+  for (;;) {
+    const auto best = std::max_element(uncovered.begin(), uncovered.end());
+    if (*best == 0) break;
+    const auto p = static_cast<uint16_t>(best - uncovered.begin());
+    order.push_back(p);
+    placed[p] = true;
+    for (uint32_t h : solved[p]) {
+      if (covered[h]) continue;
+      covered[h] = true;
+      for (uint16_t q : solvers[h]) --uncovered[q];
+    }
+  }
+
+  std::vector<uint16_t> rest;
+  for (std::size_t p = 0; p < kCount; ++p) {
+    if (!placed[p]) rest.push_back(static_cast<uint16_t>(p));
+  }
+  std::stable_sort(rest.begin(), rest.end(), [&](uint16_t x, uint16_t y) {
+    return solved[x].size() > solved[y].size();
+  });
+  order.insert(order.end(), rest.begin(), rest.end());
+  return order;
+}
+
+template <std::size_t N>
+std::vector<uint16_t> report() {
+  const auto hands = corpus<N>();
+  const auto order = profile<N>(hands);
+
+  std::vector<uint16_t> generated(count_programs(N));
+  std::iota(generated.begin(), generated.end(), 0);
+  const double before = mean_evaluated<N>(hands, generated);
+  const double current = mean_evaluated<N>(hands, detail::program_order<N>());
+  const double after = mean_evaluated<N>(hands, order);
+
+  std::cout << std::fixed << std::setprecision(2) << "N=" << N
+            << ": trees per solvable hand " << before << " (generate order), "
+            << current << " (checked in), " << after << " (profiled, "
+            << 100.0 * (before - after) / before << "% fewer)" << std::endl;
+  return order;
+}
+
+void emit(std::ostream& out, std::size_t n, const std::vector<uint16_t>& order) {
+  out << "inline constexpr uint16_t kProgramOrder" << n << "[] = {\n";
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    out << (i % 12 == 0 ? "    " : " ") << order[i] << ",";
+    if (i % 12 == 11 || i + 1 == order.size()) out << "\n";
+  }
+  out << "};\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto order2 = report<2>();
+  const auto order3 = report<3>();
+  const auto order4 = report<4>();
+  if (argc < 2) return 0;
+
+  std::ofstream out(argv[1]);
+  out << "#pragma once\n"
+         "\n"
+         "#include <cstdint>\n"
+         "\n"
+         "// Generated by meta24_profile from every hand of N values in 1.."
+      << kMaxValue
+      << ";\n"
+         "// do not edit. Program indices into kPrograms<N>, in the order "
+         "calc24\n"
+         "// tries them.\n"
+         "\n"
+         "namespace detail {\n"
+         "\n";
+  emit(out, 2, order2);
+  out << "\n";
+  emit(out, 3, order3);
+  out << "\n";
+  emit(out, 4, order4);
+  out << "\n}  // namespace detail\n";
+  if (!out) {
+    std::cerr << "cannot write " << argv[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
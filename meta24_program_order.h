@@ -0,0 +1,354 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by meta24_profile from every hand of N values in 1..13;
+// do not edit. Program indices into kPrograms<N>, in the order calc24
+// tries them.
+
+namespace detail {
+
+inline constexpr uint16_t kProgramOrder2[] = {
+    3, 0, 1, 2, 4, 5,
+};
+
+inline constexpr uint16_t kProgramOrder3[] = {
+    0, 9, 15, 51, 45, 3, 87, 81, 18, 21, 39, 20,
+    75, 54, 56, 90, 23, 27, 28, 92, 2, 6, 7, 36,
+    72, 57, 93, 33, 34, 59, 63, 64, 69, 70, 95, 99,
+    100, 105, 106, 5, 12, 13, 24, 30, 38, 41, 42, 43,
+    48, 49, 60, 66, 74, 77, 78, 79, 84, 85, 96, 102,
+    1, 4, 8, 10, 11, 14, 16, 17, 19, 22, 25, 26,
+    29, 31, 32, 35, 37, 40, 44, 46, 47, 50, 52, 53,
+    55, 58, 61, 62, 65, 67, 68, 71, 73, 76, 80, 82,
+    83, 86, 88, 89, 91, 94, 97, 98, 101, 103, 104, 107,
+};
+
+inline constexpr uint16_t kProgramOrder4[] = {
+    0, 6, 87, 831, 7, 147, 108, 110, 153, 189, 2133, 324,
+    51, 735, 18, 183, 2031, 2127, 837, 117, 123, 126, 128, 330,
+    331, 765, 20, 325, 129, 237, 333, 339, 27, 28, 435, 437,
+    774, 776, 771, 978, 979, 657, 663, 759, 867, 343, 344, 1458,
+    1495, 2106, 2143, 1413, 1419, 668, 973, 9, 15, 111, 219, 777,
+    885, 981, 987, 1422, 1424, 1323, 1324, 1731, 1733, 1626, 1627, 1161,
+    1233, 3105, 3177, 342, 1427, 1535, 1630, 1636, 1639, 1640, 56, 3296,
+    2755, 2790, 811, 846, 3, 1316, 1621, 24, 432, 159, 585, 951,
+    3825, 1155, 1227, 162, 675, 676, 1460, 1568, 2216, 453, 1083, 3402,
+    990, 1085, 1728, 351, 1326, 2144, 513, 3753, 199, 267, 3439, 352,
+    455, 2684, 1188, 1388, 1917, 2421, 2000, 81, 471, 672, 1875, 1881,
+    956, 972, 2565, 3063, 666, 2559, 303, 812, 1515, 2900, 195, 3440,
+    39, 272, 340, 704, 843, 1023, 2756, 3512, 334, 1170, 1407, 2247,
+    131, 200, 492, 522, 729, 1314, 1620, 2370, 3207, 239, 615, 1311,
+    2523, 2648, 2791, 3819, 45, 163, 982, 1305, 2139, 2967, 779, 887,
+    988, 1494, 2025, 3403, 1059, 2107, 3332, 92, 810, 2754, 3747, 847,
+    1803, 3003, 723, 1352, 3438, 198, 486, 528, 740, 1074, 1459, 2036,
+    2466, 975, 1100, 2142, 1299, 669, 997, 1013, 1496, 1673, 2321, 2957,
+    1049, 1176, 1709, 2355, 2357, 2993, 375, 390, 426, 1856, 349, 452,
+    1089, 1097, 1645, 75, 135, 136, 243, 441, 443, 449, 783, 784,
+    1540, 2472, 25, 244, 434, 673, 702, 891, 1082, 1091, 1321, 1431,
+    1730, 1737, 2646, 164, 308, 365, 377, 401, 447, 848, 892, 1061,
+    1095, 1432, 1539, 1697, 1739, 1743, 1745, 2345, 2969, 3653, 327, 920,
+    1003, 1208, 1671, 2108, 2252, 2792, 3615, 21, 30, 54, 1350, 1604,
+    1809, 1918, 1998, 2019, 2566, 2864, 3294, 90, 478, 540, 622, 738,
+    1080, 1162, 1234, 1386, 2034, 2682, 3330, 3404, 3548, 23, 328, 355,
+    560, 671, 678, 976, 1126, 1319, 1320, 1624, 1651, 1661, 1748, 1774,
+    1810, 1836, 2309, 2422, 2530, 3070, 3605, 3641, 413, 514, 579, 586,
+    1025, 1119, 1125, 1270, 1882, 2457, 2458, 2529, 3005, 3106, 3178, 3214,
+    3617, 3718, 3754, 3826, 3862, 66, 102, 363, 411, 714, 991, 1317,
+    1623, 1707, 2010, 2319, 3603, 3651, 1, 2, 31, 114, 115, 116,
+    122, 380, 484, 520, 542, 592, 628, 679, 750, 992, 1132, 1168,
+    1190, 1240, 1327, 1362, 1398, 1773, 1780, 1816, 1838, 2428, 2536, 2658,
+    3076, 36, 72, 648, 684, 720, 1296, 1332, 1368, 1944, 1980, 2016,
+    2592, 2628, 2664, 3240, 3276, 3312, 255, 261, 291, 297, 699, 795,
+    801, 903, 909, 939, 945, 1347, 1383, 1443, 1449, 1479, 1485, 1551,
+    1557, 1587, 1593, 1995, 2091, 2097, 2199, 2205, 2235, 2241, 2643, 2679,
+    2739, 2745, 2775, 2781, 2847, 2853, 2883, 2889, 3291, 3327, 3387, 3393,
+    3423, 3429, 3495, 3501, 3531, 3537, 12, 13, 38, 43, 48, 74,
+    79, 84, 144, 150, 157, 180, 186, 193, 216, 218, 252, 258,
+    265, 288, 294, 301, 654, 655, 660, 661, 686, 691, 696, 722,
+    727, 732, 756, 758, 792, 798, 805, 828, 834, 841, 864, 866,
+    900, 906, 913, 936, 942, 949, 1302, 1303, 1308, 1309, 1334, 1339,
+    1344, 1370, 1375, 1380, 1404, 1406, 1440, 1446, 1453, 1476, 1482, 1489,
+    1512, 1514, 1548, 1554, 1561, 1584, 1590, 1597, 1950, 1951, 1956, 1957,
+    1982, 1987, 1992, 2018, 2023, 2028, 2052, 2054, 2088, 2094, 2101, 2124,
+    2130, 2137, 2160, 2162, 2196, 2202, 2209, 2232, 2238, 2245, 2598, 2599,
+    2604, 2605, 2630, 2635, 2640, 2666, 2671, 2676, 2700, 2702, 2736, 2742,
+    2749, 2772, 2778, 2785, 2808, 2810, 2844, 2850, 2857, 2880, 2886, 2893,
+    3246, 3247, 3252, 3253, 3278, 3283, 3288, 3314, 3319, 3324, 3348, 3350,
+    3384, 3390, 3397, 3420, 3426, 3433, 3456, 3458, 3492, 3498, 3505, 3528,
+    3534, 3541, 225, 231, 873, 879, 1521, 1527, 2061, 2067, 2169, 2175,
+    2709, 2715, 2817, 2823, 3357, 3363, 3465, 3471, 360, 396, 1008, 1044,
+    1656, 1692, 1962, 2268, 2304, 2340, 2610, 2916, 2952, 2988, 3258, 3564,
+    3600, 3636, 234, 236, 336, 337, 362, 367, 372, 398, 403, 408,
+    882, 884, 984, 985, 1010, 1015, 1020, 1046, 1051, 1056, 1530, 1532,
+    1632, 1633, 1658, 1663, 1668, 1694, 1699, 1704, 2070, 2072, 2178, 2180,
+    2274, 2275, 2280, 2281, 2306, 2311, 2316, 2342, 2347, 2352, 2718, 2720,
+    2826, 2828, 2922, 2923, 2928, 2929, 2954, 2959, 2964, 2990, 2995, 3000,
+    3366, 3368, 3474, 3476, 3570, 3571, 3576, 3577, 3602, 3607, 3612, 3638,
+    3643, 3648, 357, 358, 383, 388, 393, 419, 424, 429, 489, 495,
+    502, 525, 531, 538, 561, 563, 597, 603, 610, 633, 639, 646,
+    999, 1000, 1005, 1006, 1031, 1036, 1041, 1067, 1072, 1077, 1101, 1103,
+    1137, 1143, 1150, 1173, 1179, 1186, 1209, 1211, 1245, 1251, 1258, 1281,
+    1287, 1294, 1647, 1648, 1653, 1654, 1679, 1684, 1689, 1715, 1720, 1725,
+    1749, 1751, 1785, 1791, 1798, 1821, 1827, 1834, 1857, 1859, 1893, 1899,
+    1906, 1929, 1935, 1942, 2295, 2296, 2301, 2302, 2327, 2332, 2337, 2363,
+    2368, 2373, 2397, 2399, 2433, 2439, 2446, 2469, 2475, 2482, 2505, 2507,
+    2541, 2547, 2554, 2577, 2583, 2590, 2943, 2944, 2949, 2950, 2975, 2980,
+    2985, 3011, 3016, 3021, 3045, 3047, 3081, 3087, 3094, 3117, 3123, 3130,
+    3153, 3155, 3189, 3195, 3202, 3225, 3231, 3238, 3591, 3592, 3597, 3598,
+    3623, 3628, 3633, 3659, 3664, 3669, 3693, 3695, 3729, 3735, 3742, 3765,
+    3771, 3778, 3801, 3803, 3837, 3843, 3850, 3873, 3879, 3886, 1953, 1959,
+    2055, 2163, 2601, 2607, 2703, 2811, 3249, 3255, 3351, 3459, 33, 34,
+    59, 64, 69, 95, 100, 105, 543, 545, 681, 682, 707, 712,
+    717, 743, 748, 753, 1191, 1193, 1329, 1330, 1355, 1360, 1365, 1391,
+    1396, 1401, 1839, 1841, 1971, 1972, 1977, 1978, 2003, 2008, 2013, 2039,
+    2044, 2049, 2379, 2381, 2487, 2489, 2619, 2620, 2625, 2626, 2651, 2656,
+    2661, 2687, 2692, 2697, 3027, 3029, 3135, 3137, 3267, 3268, 3273, 3274,
+    3299, 3304, 3309, 3335, 3340, 3345, 3675, 3677, 3783, 3785, 374, 410,
+    1022, 1058, 1670, 1706, 1964, 2269, 2318, 2354, 2612, 2917, 2966, 3002,
+    3260, 3565, 3614, 3650, 2287, 2288, 2935, 2936, 3583, 3584, 165, 201,
+    273, 309, 813, 849, 921, 957, 1425, 1461, 1497, 1533, 1569, 1605,
+    1629, 1635, 2073, 2109, 2145, 2181, 2217, 2253, 2277, 2283, 2721, 2757,
+    2793, 2829, 2865, 2901, 2925, 2931, 3369, 3405, 3441, 3477, 3513, 3549,
+    3573, 3579, 468, 504, 576, 612, 1116, 1152, 1224, 1260, 1764, 1800,
+    1872, 1908, 1968, 1974, 2376, 2412, 2448, 2484, 2520, 2556, 2616, 2622,
+    3024, 3060, 3096, 3132, 3168, 3204, 3264, 3270, 3672, 3708, 3744, 3780,
+    3816, 3852, 270, 271, 306, 307, 918, 919, 954, 955, 1566, 1567,
+    1602, 1603, 2214, 2215, 2250, 2251, 2862, 2863, 2898, 2899, 3510, 3511,
+    3546, 3547, 687, 1335, 1371, 1983, 2631, 2667, 3279, 3315, 171, 178,
+    207, 214, 279, 286, 315, 322, 477, 621, 819, 826, 855, 862,
+    927, 934, 963, 970, 1269, 1467, 1474, 1503, 1510, 1575, 1582, 1611,
+    1618, 2075, 2115, 2122, 2151, 2158, 2183, 2223, 2230, 2259, 2266, 2278,
+    2284, 2723, 2763, 2770, 2799, 2806, 2831, 2871, 2878, 2907, 2914, 2926,
+    2932, 3069, 3213, 3371, 3411, 3418, 3447, 3454, 3479, 3519, 3526, 3555,
+    3562, 3574, 3580, 3717, 3861, 594, 600, 630, 636, 1038, 1134, 1140,
+    1242, 1248, 1278, 1284, 1686, 1722, 1782, 1788, 1818, 1824, 1890, 1896,
+    1926, 1932, 2334, 2430, 2436, 2538, 2544, 2574, 2580, 2982, 3018, 3078,
+    3084, 3114, 3120, 3186, 3192, 3222, 3228, 3630, 3666, 3726, 3732, 3762,
+    3768, 3834, 3840, 3870, 3876, 507, 1263, 1767, 1911, 2415, 2451, 3099,
+    3171, 3711, 3855, 1638, 2286, 2934, 3582, 693, 807, 915, 1341, 1377,
+    1455, 1491, 1563, 1599, 1989, 2103, 2211, 2637, 2673, 2751, 2787, 2859,
+    2895, 3285, 3321, 3399, 3435, 3507, 3543, 2046, 2694, 3306, 3342, 41,
+    77, 689, 725, 1337, 1373, 1985, 2021, 2633, 2669, 3281, 3317, 369,
+    405, 1017, 1053, 1665, 1701, 2313, 2349, 2961, 2997, 3609, 3645, 416,
+    1028, 1064, 1676, 1712, 2324, 2360, 2972, 3008, 3620, 3656, 141, 142,
+    167, 172, 177, 203, 208, 213, 249, 250, 275, 280, 285, 311,
+    316, 321, 399, 549, 551, 555, 557, 789, 790, 815, 820, 825,
+    851, 856, 861, 897, 898, 923, 928, 933, 959, 964, 969, 1011,
+    1047, 1197, 1199, 1203, 1205, 1437, 1438, 1463, 1468, 1473, 1499, 1504,
+    1509, 1545, 1546, 1571, 1576, 1581, 1607, 1612, 1617, 1659, 1695, 1845,
+    1847, 1851, 1853, 2079, 2080, 2085, 2086, 2111, 2116, 2121, 2147, 2152,
+    2157, 2187, 2188, 2193, 2194, 2219, 2224, 2229, 2255, 2260, 2265, 2307,
+    2343, 2385, 2387, 2391, 2393, 2493, 2495, 2499, 2501, 2727, 2728, 2733,
+    2734, 2759, 2764, 2769, 2795, 2800, 2805, 2835, 2836, 2841, 2842, 2867,
+    2872, 2877, 2903, 2908, 2913, 2955, 2991, 3033, 3035, 3039, 3041, 3141,
+    3143, 3147, 3149, 3375, 3376, 3381, 3382, 3407, 3412, 3417, 3443, 3448,
+    3453, 3483, 3484, 3489, 3490, 3515, 3520, 3525, 3551, 3556, 3561, 3639,
+    3681, 3683, 3687, 3689, 3789, 3791, 3795, 3797, 378, 414, 1026, 1062,
+    1674, 1710, 2322, 2358, 2970, 3006, 3618, 3654, 57, 93, 651, 705,
+    741, 1353, 1389, 1947, 1965, 2001, 2037, 2271, 2595, 2613, 2649, 2685,
+    2919, 3243, 3261, 3297, 3333, 3567, 345, 381, 417, 993, 1029, 1065,
+    1641, 1677, 1713, 2289, 2325, 2361, 2937, 2973, 3009, 3585, 3621, 3657,
+    392, 428, 488, 494, 524, 530, 596, 602, 632, 638, 1040, 1076,
+    1136, 1142, 1172, 1178, 1244, 1250, 1280, 1286, 1688, 1724, 1784, 1790,
+    1820, 1826, 1892, 1898, 1928, 1934, 2336, 2372, 2432, 2438, 2468, 2474,
+    2540, 2546, 2576, 2582, 2984, 3020, 3080, 3086, 3116, 3122, 3188, 3194,
+    3224, 3230, 3632, 3668, 3728, 3734, 3764, 3770, 3836, 3842, 3872, 3878,
+    2293, 2299, 2396, 2504, 2941, 2947, 3044, 3152, 3589, 3595, 3692, 3800,
+    348, 354, 450, 483, 519, 558, 591, 627, 996, 1002, 1098, 1131,
+    1167, 1206, 1239, 1275, 1644, 1650, 1746, 1779, 1815, 1854, 1887, 1923,
+    2292, 2298, 2394, 2427, 2463, 2502, 2535, 2571, 2940, 2946, 3042, 3075,
+    3111, 3150, 3183, 3219, 3588, 3594, 3690, 3723, 3759, 3798, 3831, 3867,
+    10, 16, 113, 168, 169, 204, 205, 221, 276, 277, 312, 313,
+    346, 347, 387, 394, 395, 423, 430, 431, 459, 460, 461, 465,
+    466, 467, 490, 491, 496, 497, 501, 526, 527, 532, 533, 537,
+    567, 568, 569, 573, 574, 575, 598, 599, 604, 605, 609, 634,
+    635, 640, 641, 645, 658, 664, 761, 816, 817, 852, 853, 869,
+    924, 925, 960, 961, 994, 995, 1035, 1042, 1043, 1071, 1078, 1079,
+    1107, 1108, 1109, 1113, 1114, 1115, 1138, 1139, 1144, 1145, 1149, 1174,
+    1175, 1180, 1181, 1185, 1215, 1216, 1217, 1221, 1222, 1223, 1246, 1247,
+    1252, 1253, 1257, 1282, 1283, 1288, 1289, 1293, 1306, 1312, 1409, 1464,
+    1465, 1500, 1501, 1517, 1572, 1573, 1608, 1609, 1642, 1643, 1683, 1690,
+    1691, 1719, 1726, 1727, 1755, 1756, 1757, 1761, 1762, 1763, 1786, 1787,
+    1792, 1793, 1797, 1822, 1823, 1828, 1829, 1833, 1863, 1864, 1865, 1869,
+    1870, 1871, 1894, 1895, 1900, 1901, 1905, 1930, 1931, 1936, 1937, 1941,
+    1954, 1960, 2057, 2112, 2113, 2148, 2149, 2165, 2220, 2221, 2256, 2257,
+    2290, 2291, 2331, 2338, 2339, 2367, 2374, 2375, 2403, 2404, 2405, 2409,
+    2410, 2411, 2434, 2435, 2440, 2441, 2445, 2470, 2471, 2476, 2477, 2481,
+    2511, 2512, 2513, 2517, 2518, 2519, 2542, 2543, 2548, 2549, 2553, 2578,
+    2579, 2584, 2585, 2589, 2602, 2608, 2705, 2760, 2761, 2796, 2797, 2813,
+    2868, 2869, 2904, 2905, 2938, 2939, 2979, 2986, 2987, 3015, 3022, 3023,
+    3051, 3052, 3053, 3057, 3058, 3059, 3082, 3083, 3088, 3089, 3093, 3118,
+    3119, 3124, 3125, 3129, 3159, 3160, 3161, 3165, 3166, 3167, 3190, 3191,
+    3196, 3197, 3201, 3226, 3227, 3232, 3233, 3237, 3250, 3256, 3353, 3408,
+    3409, 3444, 3445, 3461, 3516, 3517, 3552, 3553, 3586, 3587, 3627, 3634,
+    3635, 3663, 3670, 3671, 3699, 3700, 3701, 3705, 3706, 3707, 3730, 3731,
+    3736, 3737, 3741, 3766, 3767, 3772, 3773, 3777, 3807, 3808, 3809, 3813,
+    3814, 3815, 3838, 3839, 3844, 3845, 3849, 3874, 3875, 3880, 3881, 3885,
+    474, 481, 510, 517, 582, 589, 618, 625, 1122, 1129, 1158, 1165,
+    1230, 1237, 1266, 1273, 1770, 1777, 1806, 1813, 1878, 1885, 1914, 1921,
+    1969, 1975, 2378, 2418, 2425, 2454, 2461, 2486, 2526, 2533, 2562, 2569,
+    2617, 2623, 3026, 3066, 3073, 3102, 3109, 3134, 3174, 3181, 3210, 3217,
+    3265, 3271, 3674, 3714, 3721, 3750, 3757, 3782, 3822, 3829, 3858, 3865,
+    63, 70, 99, 106, 711, 718, 747, 754, 1359, 1366, 1395, 1402,
+    1967, 2007, 2014, 2043, 2050, 2272, 2615, 2655, 2662, 2691, 2698, 2920,
+    3263, 3303, 3310, 3339, 3346, 3568, 1276, 1888, 1924, 2464, 2572, 3112,
+    3184, 3220, 3724, 3760, 3832, 3868, 19, 326, 366, 373, 402, 409,
+    667, 974, 1014, 1021, 1050, 1057, 1315, 1622, 1662, 1669, 1698, 1705,
+    1963, 2270, 2310, 2317, 2346, 2353, 2611, 2918, 2958, 2965, 2994, 3001,
+    3259, 3566, 3606, 3613, 3642, 3649, 22, 53, 68, 71, 89, 104,
+    107, 132, 134, 138, 140, 149, 155, 174, 175, 185, 191, 210,
+    211, 240, 242, 246, 248, 257, 263, 282, 283, 293, 299, 318,
+    319, 329, 384, 420, 438, 439, 444, 445, 456, 462, 470, 473,
+    475, 480, 498, 506, 509, 511, 516, 534, 546, 547, 552, 553,
+    564, 570, 578, 581, 583, 588, 606, 614, 617, 619, 624, 642,
+    670, 701, 716, 719, 737, 752, 755, 780, 782, 786, 788, 797,
+    803, 822, 823, 833, 839, 858, 859, 888, 890, 894, 896, 905,
+    911, 930, 931, 941, 947, 966, 967, 977, 1032, 1068, 1086, 1087,
+    1092, 1093, 1104, 1110, 1118, 1121, 1123, 1128, 1146, 1154, 1157, 1159,
+    1164, 1182, 1194, 1195, 1200, 1201, 1212, 1218, 1226, 1229, 1231, 1236,
+    1254, 1262, 1265, 1267, 1272, 1290, 1318, 1349, 1364, 1367, 1385, 1400,
+    1403, 1428, 1430, 1434, 1436, 1445, 1451, 1470, 1471, 1481, 1487, 1506,
+    1507, 1536, 1538, 1542, 1544, 1553, 1559, 1578, 1579, 1589, 1595, 1614,
+    1615, 1625, 1680, 1716, 1734, 1735, 1740, 1741, 1752, 1758, 1766, 1769,
+    1771, 1776, 1794, 1802, 1805, 1807, 1812, 1830, 1842, 1843, 1848, 1849,
+    1860, 1866, 1874, 1877, 1879, 1884, 1902, 1910, 1913, 1915, 1920, 1938,
+    1966, 1997, 2012, 2015, 2033, 2048, 2051, 2076, 2078, 2082, 2084, 2093,
+    2099, 2118, 2119, 2129, 2135, 2154, 2155, 2184, 2186, 2190, 2192, 2201,
+    2207, 2226, 2227, 2237, 2243, 2262, 2263, 2273, 2328, 2364, 2382, 2383,
+    2388, 2389, 2400, 2406, 2414, 2417, 2419, 2424, 2442, 2450, 2453, 2455,
+    2460, 2478, 2490, 2491, 2496, 2497, 2508, 2514, 2522, 2525, 2527, 2532,
+    2550, 2558, 2561, 2563, 2568, 2586, 2614, 2645, 2660, 2663, 2681, 2696,
+    2699, 2724, 2726, 2730, 2732, 2741, 2747, 2766, 2767, 2777, 2783, 2802,
+    2803, 2832, 2834, 2838, 2840, 2849, 2855, 2874, 2875, 2885, 2891, 2910,
+    2911, 2921, 2976, 3012, 3030, 3031, 3036, 3037, 3048, 3054, 3062, 3065,
+    3067, 3072, 3090, 3098, 3101, 3103, 3108, 3126, 3138, 3139, 3144, 3145,
+    3156, 3162, 3170, 3173, 3175, 3180, 3198, 3206, 3209, 3211, 3216, 3234,
+    3262, 3293, 3308, 3311, 3329, 3344, 3347, 3372, 3374, 3378, 3380, 3389,
+    3395, 3414, 3415, 3425, 3431, 3450, 3451, 3480, 3482, 3486, 3488, 3497,
+    3503, 3522, 3523, 3533, 3539, 3558, 3559, 3569, 3624, 3660, 3678, 3679,
+    3684, 3685, 3696, 3702, 3710, 3713, 3715, 3720, 3738, 3746, 3749, 3751,
+    3756, 3774, 3786, 3787, 3792, 3793, 3804, 3810, 3818, 3821, 3823, 3828,
+    3846, 3854, 3857, 3859, 3864, 3882, 42, 49, 50, 78, 85, 86,
+    120, 121, 145, 146, 151, 152, 156, 181, 182, 187, 188, 192,
+    222, 223, 224, 228, 229, 230, 253, 254, 259, 260, 264, 289,
+    290, 295, 296, 300, 649, 650, 690, 697, 698, 726, 733, 734,
+    762, 763, 764, 768, 769, 770, 793, 794, 799, 800, 804, 829,
+    830, 835, 836, 840, 870, 871, 872, 876, 877, 878, 901, 902,
+    907, 908, 912, 937, 938, 943, 944, 948, 1297, 1298, 1338, 1345,
+    1346, 1374, 1381, 1382, 1410, 1411, 1412, 1416, 1417, 1418, 1441, 1442,
+    1447, 1448, 1452, 1477, 1478, 1483, 1484, 1488, 1518, 1519, 1520, 1524,
+    1525, 1526, 1549, 1550, 1555, 1556, 1560, 1585, 1586, 1591, 1592, 1596,
+    1945, 1946, 1986, 1993, 1994, 2022, 2029, 2030, 2058, 2059, 2060, 2064,
+    2065, 2066, 2089, 2090, 2095, 2096, 2100, 2125, 2126, 2131, 2132, 2136,
+    2166, 2167, 2168, 2172, 2173, 2174, 2197, 2198, 2203, 2204, 2208, 2233,
+    2234, 2239, 2240, 2244, 2593, 2594, 2634, 2641, 2642, 2670, 2677, 2678,
+    2706, 2707, 2708, 2712, 2713, 2714, 2737, 2738, 2743, 2744, 2748, 2773,
+    2774, 2779, 2780, 2784, 2814, 2815, 2816, 2820, 2821, 2822, 2845, 2846,
+    2851, 2852, 2856, 2881, 2882, 2887, 2888, 2892, 3241, 3242, 3282, 3289,
+    3290, 3318, 3325, 3326, 3354, 3355, 3356, 3360, 3361, 3362, 3385, 3386,
+    3391, 3392, 3396, 3421, 3422, 3427, 3428, 3432, 3462, 3463, 3464, 3468,
+    3469, 3470, 3493, 3494, 3499, 3500, 3504, 3529, 3530, 3535, 3536, 3540,
+    4, 5, 8, 11, 14, 17, 26, 29, 32, 35, 37, 40,
+    44, 46, 47, 52, 55, 58, 60, 61, 62, 65, 67, 73,
+    76, 80, 82, 83, 88, 91, 94, 96, 97, 98, 101, 103,
+    109, 112, 118, 119, 124, 125, 127, 130, 133, 137, 139, 143,
+    148, 154, 158, 160, 161, 166, 170, 173, 176, 179, 184, 190,
+    194, 196, 197, 202, 206, 209, 212, 215, 217, 220, 226, 227,
+    232, 233, 235, 238, 241, 245, 247, 251, 256, 262, 266, 268,
+    269, 274, 278, 281, 284, 287, 292, 298, 302, 304, 305, 310,
+    314, 317, 320, 323, 332, 335, 338, 341, 350, 353, 356, 359,
+    361, 364, 368, 370, 371, 376, 379, 382, 385, 386, 389, 391,
+    397, 400, 404, 406, 407, 412, 415, 418, 421, 422, 425, 427,
+    433, 436, 440, 442, 446, 448, 451, 454, 457, 458, 463, 464,
+    469, 472, 476, 479, 482, 485, 487, 493, 499, 500, 503, 505,
+    508, 512, 515, 518, 521, 523, 529, 535, 536, 539, 541, 544,
+    548, 550, 554, 556, 559, 562, 565, 566, 571, 572, 577, 580,
+    584, 587, 590, 593, 595, 601, 607, 608, 611, 613, 616, 620,
+    623, 626, 629, 631, 637, 643, 644, 647, 652, 653, 656, 659,
+    662, 665, 674, 677, 680, 683, 685, 688, 692, 694, 695, 700,
+    703, 706, 708, 709, 710, 713, 715, 721, 724, 728, 730, 731,
+    736, 739, 742, 744, 745, 746, 749, 751, 757, 760, 766, 767,
+    772, 773, 775, 778, 781, 785, 787, 791, 796, 802, 806, 808,
+    809, 814, 818, 821, 824, 827, 832, 838, 842, 844, 845, 850,
+    854, 857, 860, 863, 865, 868, 874, 875, 880, 881, 883, 886,
+    889, 893, 895, 899, 904, 910, 914, 916, 917, 922, 926, 929,
+    932, 935, 940, 946, 950, 952, 953, 958, 962, 965, 968, 971,
+    980, 983, 986, 989, 998, 1001, 1004, 1007, 1009, 1012, 1016, 1018,
+    1019, 1024, 1027, 1030, 1033, 1034, 1037, 1039, 1045, 1048, 1052, 1054,
+    1055, 1060, 1063, 1066, 1069, 1070, 1073, 1075, 1081, 1084, 1088, 1090,
+    1094, 1096, 1099, 1102, 1105, 1106, 1111, 1112, 1117, 1120, 1124, 1127,
+    1130, 1133, 1135, 1141, 1147, 1148, 1151, 1153, 1156, 1160, 1163, 1166,
+    1169, 1171, 1177, 1183, 1184, 1187, 1189, 1192, 1196, 1198, 1202, 1204,
+    1207, 1210, 1213, 1214, 1219, 1220, 1225, 1228, 1232, 1235, 1238, 1241,
+    1243, 1249, 1255, 1256, 1259, 1261, 1264, 1268, 1271, 1274, 1277, 1279,
+    1285, 1291, 1292, 1295, 1300, 1301, 1304, 1307, 1310, 1313, 1322, 1325,
+    1328, 1331, 1333, 1336, 1340, 1342, 1343, 1348, 1351, 1354, 1356, 1357,
+    1358, 1361, 1363, 1369, 1372, 1376, 1378, 1379, 1384, 1387, 1390, 1392,
+    1393, 1394, 1397, 1399, 1405, 1408, 1414, 1415, 1420, 1421, 1423, 1426,
+    1429, 1433, 1435, 1439, 1444, 1450, 1454, 1456, 1457, 1462, 1466, 1469,
+    1472, 1475, 1480, 1486, 1490, 1492, 1493, 1498, 1502, 1505, 1508, 1511,
+    1513, 1516, 1522, 1523, 1528, 1529, 1531, 1534, 1537, 1541, 1543, 1547,
+    1552, 1558, 1562, 1564, 1565, 1570, 1574, 1577, 1580, 1583, 1588, 1594,
+    1598, 1600, 1601, 1606, 1610, 1613, 1616, 1619, 1628, 1631, 1634, 1637,
+    1646, 1649, 1652, 1655, 1657, 1660, 1664, 1666, 1667, 1672, 1675, 1678,
+    1681, 1682, 1685, 1687, 1693, 1696, 1700, 1702, 1703, 1708, 1711, 1714,
+    1717, 1718, 1721, 1723, 1729, 1732, 1736, 1738, 1742, 1744, 1747, 1750,
+    1753, 1754, 1759, 1760, 1765, 1768, 1772, 1775, 1778, 1781, 1783, 1789,
+    1795, 1796, 1799, 1801, 1804, 1808, 1811, 1814, 1817, 1819, 1825, 1831,
+    1832, 1835, 1837, 1840, 1844, 1846, 1850, 1852, 1855, 1858, 1861, 1862,
+    1867, 1868, 1873, 1876, 1880, 1883, 1886, 1889, 1891, 1897, 1903, 1904,
+    1907, 1909, 1912, 1916, 1919, 1922, 1925, 1927, 1933, 1939, 1940, 1943,
+    1948, 1949, 1952, 1955, 1958, 1961, 1970, 1973, 1976, 1979, 1981, 1984,
+    1988, 1990, 1991, 1996, 1999, 2002, 2004, 2005, 2006, 2009, 2011, 2017,
+    2020, 2024, 2026, 2027, 2032, 2035, 2038, 2040, 2041, 2042, 2045, 2047,
+    2053, 2056, 2062, 2063, 2068, 2069, 2071, 2074, 2077, 2081, 2083, 2087,
+    2092, 2098, 2102, 2104, 2105, 2110, 2114, 2117, 2120, 2123, 2128, 2134,
+    2138, 2140, 2141, 2146, 2150, 2153, 2156, 2159, 2161, 2164, 2170, 2171,
+    2176, 2177, 2179, 2182, 2185, 2189, 2191, 2195, 2200, 2206, 2210, 2212,
+    2213, 2218, 2222, 2225, 2228, 2231, 2236, 2242, 2246, 2248, 2249, 2254,
+    2258, 2261, 2264, 2267, 2276, 2279, 2282, 2285, 2294, 2297, 2300, 2303,
+    2305, 2308, 2312, 2314, 2315, 2320, 2323, 2326, 2329, 2330, 2333, 2335,
+    2341, 2344, 2348, 2350, 2351, 2356, 2359, 2362, 2365, 2366, 2369, 2371,
+    2377, 2380, 2384, 2386, 2390, 2392, 2395, 2398, 2401, 2402, 2407, 2408,
+    2413, 2416, 2420, 2423, 2426, 2429, 2431, 2437, 2443, 2444, 2447, 2449,
+    2452, 2456, 2459, 2462, 2465, 2467, 2473, 2479, 2480, 2483, 2485, 2488,
+    2492, 2494, 2498, 2500, 2503, 2506, 2509, 2510, 2515, 2516, 2521, 2524,
+    2528, 2531, 2534, 2537, 2539, 2545, 2551, 2552, 2555, 2557, 2560, 2564,
+    2567, 2570, 2573, 2575, 2581, 2587, 2588, 2591, 2596, 2597, 2600, 2603,
+    2606, 2609, 2618, 2621, 2624, 2627, 2629, 2632, 2636, 2638, 2639, 2644,
+    2647, 2650, 2652, 2653, 2654, 2657, 2659, 2665, 2668, 2672, 2674, 2675,
+    2680, 2683, 2686, 2688, 2689, 2690, 2693, 2695, 2701, 2704, 2710, 2711,
+    2716, 2717, 2719, 2722, 2725, 2729, 2731, 2735, 2740, 2746, 2750, 2752,
+    2753, 2758, 2762, 2765, 2768, 2771, 2776, 2782, 2786, 2788, 2789, 2794,
+    2798, 2801, 2804, 2807, 2809, 2812, 2818, 2819, 2824, 2825, 2827, 2830,
+    2833, 2837, 2839, 2843, 2848, 2854, 2858, 2860, 2861, 2866, 2870, 2873,
+    2876, 2879, 2884, 2890, 2894, 2896, 2897, 2902, 2906, 2909, 2912, 2915,
+    2924, 2927, 2930, 2933, 2942, 2945, 2948, 2951, 2953, 2956, 2960, 2962,
+    2963, 2968, 2971, 2974, 2977, 2978, 2981, 2983, 2989, 2992, 2996, 2998,
+    2999, 3004, 3007, 3010, 3013, 3014, 3017, 3019, 3025, 3028, 3032, 3034,
+    3038, 3040, 3043, 3046, 3049, 3050, 3055, 3056, 3061, 3064, 3068, 3071,
+    3074, 3077, 3079, 3085, 3091, 3092, 3095, 3097, 3100, 3104, 3107, 3110,
+    3113, 3115, 3121, 3127, 3128, 3131, 3133, 3136, 3140, 3142, 3146, 3148,
+    3151, 3154, 3157, 3158, 3163, 3164, 3169, 3172, 3176, 3179, 3182, 3185,
+    3187, 3193, 3199, 3200, 3203, 3205, 3208, 3212, 3215, 3218, 3221, 3223,
+    3229, 3235, 3236, 3239, 3244, 3245, 3248, 3251, 3254, 3257, 3266, 3269,
+    3272, 3275, 3277, 3280, 3284, 3286, 3287, 3292, 3295, 3298, 3300, 3301,
+    3302, 3305, 3307, 3313, 3316, 3320, 3322, 3323, 3328, 3331, 3334, 3336,
+    3337, 3338, 3341, 3343, 3349, 3352, 3358, 3359, 3364, 3365, 3367, 3370,
+    3373, 3377, 3379, 3383, 3388, 3394, 3398, 3400, 3401, 3406, 3410, 3413,
+    3416, 3419, 3424, 3430, 3434, 3436, 3437, 3442, 3446, 3449, 3452, 3455,
+    3457, 3460, 3466, 3467, 3472, 3473, 3475, 3478, 3481, 3485, 3487, 3491,
+    3496, 3502, 3506, 3508, 3509, 3514, 3518, 3521, 3524, 3527, 3532, 3538,
+    3542, 3544, 3545, 3550, 3554, 3557, 3560, 3563, 3572, 3575, 3578, 3581,
+    3590, 3593, 3596, 3599, 3601, 3604, 3608, 3610, 3611, 3616, 3619, 3622,
+    3625, 3626, 3629, 3631, 3637, 3640, 3644, 3646, 3647, 3652, 3655, 3658,
+    3661, 3662, 3665, 3667, 3673, 3676, 3680, 3682, 3686, 3688, 3691, 3694,
+    3697, 3698, 3703, 3704, 3709, 3712, 3716, 3719, 3722, 3725, 3727, 3733,
+    3739, 3740, 3743, 3745, 3748, 3752, 3755, 3758, 3761, 3763, 3769, 3775,
+    3776, 3779, 3781, 3784, 3788, 3790, 3794, 3796, 3799, 3802, 3805, 3806,
+    3811, 3812, 3817, 3820, 3824, 3827, 3830, 3833, 3835, 3841, 3847, 3848,
+    3851, 3853, 3856, 3860, 3863, 3866, 3869, 3871, 3877, 3883, 3884, 3887,
+};
+
+}  // namespace detail
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "meta24_constexpr.h"
+
+// ============================================================================
+// meta24_stream.h — compact binary stream of solved hands.
+//
+// One fixed-size record per hand instead of a formatted line; rendering is
+// left to whoever reads the stream (see meta24_decode).
+//
+// Layout (little-endian):
+//   char     magic[4] = "M24R"
+//   uint8_t  n              inputs per hand
+//   uint8_t  record_size    bytes per record, record_size(n)
+//   uint16_t reserved
+//   frames, each:
+//     uint32_t count        records in this frame; 0 ends the stream
+//     records[count], each:
+//       uint8_t hand[n]     integer values 0..255
+//       uint8_t status      kNoSolution or kSolved
+//       program             SolutionHandle::program, program_bytes(n) bytes
+//       perm                SolutionHandle::perm, perm_bytes(n) bytes
+//
+// A stream without its empty end frame was cut short.
+// ============================================================================
+
+namespace result_stream {
+
+constexpr char kMagic[4] = {'M', '2', '4', 'R'};
+constexpr std::size_t kFrameRecords = 4096;
+
+enum Status : uint8_t { kNoSolution = 0, kSolved = 1 };
+
+constexpr std::size_t program_bytes(std::size_t n) {
+  std::size_t bytes = 1;
+  while ((count_programs(n) - 1) >> (8 * bytes) != 0) ++bytes;
+  return bytes;
+}
+
+constexpr std::size_t perm_bytes(std::size_t n) { return (3 * n + 7) / 8; }
+
+constexpr std::size_t record_size(std::size_t n) {
+  return n + 1 + program_bytes(n) + perm_bytes(n);
+}
+
+static_assert(record_size(kMaxHandleInputs) <= UINT8_MAX);
+
+struct Record {
+  std::array<uint8_t, kMaxHandleInputs> hand{};
+  Status status = kNoSolution;
+  SolutionHandle handle;
+
+  // The hand as solver input.
+  template <std::size_t N>
+  std::array<double, N> values() const {
+    std::array<double, N> a;
+    for (std::size_t i = 0; i < N; ++i) a[i] = hand[i];
+    return a;
+  }
+};
+
+namespace detail {
+
+inline void put_le(char* out, uint64_t value, std::size_t bytes) {
+  for (std::size_t i = 0; i < bytes; ++i) {
+    out[i] = static_cast<char>(value >> (8 * i));
+  }
+}
+
+inline uint64_t get_le(const char* in, std::size_t bytes) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(in[i])) << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace detail
+
+// Buffers records and writes them a frame at a time. finish() writes the
+// end frame; without it the stream reads as truncated.
+class Writer {
+ public:
+  Writer(std::ostream& out, std::size_t n)
+      : out_(out), size_(record_size(n)) {
+    char header[8] = {};
+    std::memcpy(header, kMagic, sizeof(kMagic));
+    header[4] = static_cast<char>(n);
+    header[5] = static_cast<char>(size_);
+    out_.write(header, sizeof(header));
+    frame_.reserve(4 + kFrameRecords * size_);
+    frame_.resize(4);
+  }
+
+  // `hand` must hold integers in 0..255.
+  template <std::size_t N>
+  void add(const std::array<double, N>& hand, const SolutionHandle& h) {
+    frame_.resize(frame_.size() + size_);
+    char* r = frame_.data() + frame_.size() - size_;
+    for (std::size_t i = 0; i < N; ++i) r[i] = static_cast<char>(hand[i]);
+    r[N] = h.solved() ? kSolved : kNoSolution;
+    detail::put_le(r + N + 1, h.program, program_bytes(N));
+    detail::put_le(r + N + 1 + program_bytes(N), h.perm, perm_bytes(N));
+    if (++count_ == kFrameRecords) flush();
+  }
+
+  void flush() {
+    if (count_ == 0) return;
+    detail::put_le(frame_.data(), count_, 4);
+    out_.write(frame_.data(), frame_.size());
+    frame_.resize(4);
+    count_ = 0;
+  }
+
+  // Returns false if any write failed.
+  bool finish() {
+    flush();
+    const char end[4] = {};
+    out_.write(end, sizeof(end));
+    out_.flush();
+    return static_cast<bool>(out_);
+  }
+
+ private:
+  std::ostream& out_;
+  std::size_t size_;
+  std::vector<char> frame_;
+  std::size_t count_ = 0;
+};
+
+class Reader {
+ public:
+  // Check valid() before reading records.
+  explicit Reader(std::istream& in) : in_(in) {
+    char header[8];
+    if (!in_.read(header, sizeof(header)) ||
+        std::memcmp(header, kMagic, sizeof(kMagic)) != 0) {
+      return;
+    }
+    n_ = static_cast<uint8_t>(header[4]);
+    size_ = static_cast<uint8_t>(header[5]);
+    valid_ = n_ >= 1 && n_ <= kMaxHandleInputs && size_ == record_size(n_);
+  }
+
+  bool valid() const { return valid_; }
+  std::size_t n() const { return n_; }
+  // True once the end frame has been read.
+  bool complete() const { return complete_; }
+
+  // Reads the next record; false at the end of the stream or on a short
+  // read, which complete() tells apart.
+  bool next(Record& record) {
+    if (!valid_ || complete_) return false;
+    if (pos_ == frame_.size()) {
+      char count[4];
+      if (!in_.read(count, sizeof(count))) return false;
+      const uint64_t records = detail::get_le(count, 4);
+      if (records == 0) {
+        complete_ = true;
+        return false;
+      }
+      frame_.resize(records * size_);
+      if (!in_.read(frame_.data(), frame_.size())) return false;
+      pos_ = 0;
+    }
+    const char* r = frame_.data() + pos_;
+    pos_ += size_;
+    for (std::size_t i = 0; i < n_; ++i) record.hand[i] = r[i];
+    record.status = static_cast<Status>(r[n_]);
+    // An unsolved program index does not fit the field; it is implied.
+    record.handle.program =
+        record.status == kSolved
+            ? detail::get_le(r + n_ + 1, program_bytes(n_))
+            : SolutionHandle::kNoProgram;
+    record.handle.perm =
+        detail::get_le(r + n_ + 1 + program_bytes(n_), perm_bytes(n_));
+    return true;
+  }
+
+ private:
+  std::istream& in_;
+  std::size_t n_ = 0;
+  std::size_t size_ = 0;
+  bool valid_ = false;
+  bool complete_ = false;
+  std::vector<char> frame_;
+  std::size_t pos_ = 0;
+};
+
+}  // namespace result_stream
@@ -0,0 +1,51 @@
+#include "meta24_stream.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+TEST(ResultStreamTest, RoundTrip) {
+  std::vector<std::array<double, 4>> hands;
+  for (int h = 0; h < 5000; ++h) {
+    hands.push_back({double(h % 13 + 1), double(h / 13 % 13 + 1),
+                     double(h / 169 % 13 + 1), double(h % 7)});
+  }
+  std::stringstream stream;
+  result_stream::Writer writer(stream, 4);
+  for (const auto& hand : hands) writer.add(hand, solve(hand));
+  EXPECT_TRUE(writer.finish());
+  EXPECT_EQ(stream.str().size(),
+            8 + 4 * 3 + hands.size() * result_stream::record_size(4));
+
+  result_stream::Reader reader(stream);
+  ASSERT_TRUE(reader.valid());
+  EXPECT_EQ(reader.n(), 4u);
+  result_stream::Record record;
+  for (const auto& hand : hands) {
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.values<4>(), hand);
+    const auto expected = calc24(hand);
+    ASSERT_EQ(record.status == result_stream::kSolved, expected.has_value());
+    if (expected) {
+      EXPECT_EQ(format(record.handle, hand), *expected);
+    }
+  }
+  EXPECT_FALSE(reader.next(record));
+  EXPECT_TRUE(reader.complete());
+}
+
+TEST(ResultStreamTest, Truncated) {
+  std::stringstream stream;
+  result_stream::Writer writer(stream, 6);
+  const std::array<double, 6> hand{1, 2, 3, 4, 5, 6};
+  writer.add(hand, solve(hand));
+  writer.flush();
+
+  result_stream::Reader reader(stream);
+  ASSERT_TRUE(reader.valid());
+  result_stream::Record record;
+  ASSERT_TRUE(reader.next(record));
+  EXPECT_EQ(format(record.handle, record.values<6>()), *calc24(hand));
+  EXPECT_FALSE(reader.next(record));
+  EXPECT_FALSE(reader.complete());
+}
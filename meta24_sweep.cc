@@ -0,0 +1,259 @@
+#include "meta24_constexpr.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// meta24_sweep — sharded sweep of every hand of N values in 1..V.
+//
+// Hands are visited in canonical order: each distinct multiset once, as a
+// non-decreasing sequence, in lexicographic order. The rank of a hand in
+// that order is what shards split on, so
+//
+//   meta24_sweep run N V SHARD SHARDS OUT
+//
+// solves the contiguous, equally sized rank range [SHARD*T/SHARDS,
+// (SHARD+1)*T/SHARDS) of the T = C(V+N-1, N) hands without any coordination
+// between shards, and
+//
+//   meta24_sweep merge OUT PARTIAL...
+//
+// checks that the partial files cover 0..T exactly once and joins them.
+//
+// File layout (little-endian):
+//   char     magic[4] = "M24S"
+//   uint8_t  n
+//   uint8_t  reserved
+//   uint16_t max_value
+//   uint64_t total       number of canonical hands
+//   uint64_t begin       rank of the first hand in this file
+//   uint64_t count       number of hands in this file
+//   uint8_t  solved[(count + 7) / 8]   bit k set if hand begin+k is solvable
+//
+// A merged dataset is the same format with begin = 0 and count = total.
+// ============================================================================
+
+namespace {
+
+constexpr char kMagic[4] = {'M', '2', '4', 'S'};
+
+struct Header {
+  uint8_t n = 0;
+  uint16_t max_value = 0;
+  uint64_t total = 0;
+  uint64_t begin = 0;
+  uint64_t count = 0;
+};
+
+struct Partial {
+  Header header;
+  std::vector<uint8_t> solved;
+};
+
+// Number of multisets of size k drawn from m values.
+uint64_t multisets(uint64_t m, uint64_t k) {
+  // C(m + k - 1, k), computed incrementally so every step stays exact.
+  uint64_t result = 1;
+  for (uint64_t i = 1; i <= k; ++i) result = result * (m + i - 1) / i;
+  return result;
+}
+
+// The canonical hand of rank `rank`.
+template <std::size_t N>
+std::array<int, N> unrank(uint64_t rank, int max_value) {
+  std::array<int, N> hand{};
+  int lo = 1;
+  for (std::size_t k = 0; k < N; ++k) {
+    for (int v = lo;; ++v) {
+      const uint64_t below = multisets(max_value - v + 1, N - k - 1);
+      if (rank < below) {
+        hand[k] = lo = v;
+        break;
+      }
+      rank -= below;
+    }
+  }
+  return hand;
+}
+
+// Advance to the next canonical hand.
+template <std::size_t N>
+void next_hand(std::array<int, N>& hand, int max_value) {
+  std::size_t k = N;
+  while (k > 0 && hand[k - 1] == max_value) --k;
+  if (k == 0) return;
+  const int v = hand[k - 1] + 1;
+  for (std::size_t i = k - 1; i < N; ++i) hand[i] = v;
+}
+
+template <typename T>
+void put(std::ostream& out, T value) {
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    out.put(static_cast<char>(static_cast<uint64_t>(value) >> (8 * i)));
+  }
+}
+
+template <typename T>
+T get(std::istream& in) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(in.get())) << (8 * i);
+  }
+  return static_cast<T>(value);
+}
+
+bool write_partial(const std::string& path, const Partial& p) {
+  std::ofstream out(path, std::ios::binary);
+  out.write(kMagic, sizeof(kMagic));
+  put<uint8_t>(out, p.header.n);
+  put<uint8_t>(out, 0);
+  put<uint16_t>(out, p.header.max_value);
+  put<uint64_t>(out, p.header.total);
+  put<uint64_t>(out, p.header.begin);
+  put<uint64_t>(out, p.header.count);
+  out.write(reinterpret_cast<const char*>(p.solved.data()), p.solved.size());
+  return static_cast<bool>(out);
+}
+
+bool read_partial(const std::string& path, Partial& p) {
+  std::ifstream in(path, std::ios::binary);
+  char magic[sizeof(kMagic)];
+  if (!in.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    return false;
+  }
+  p.header.n = get<uint8_t>(in);
+  get<uint8_t>(in);
+  p.header.max_value = get<uint16_t>(in);
+  p.header.total = get<uint64_t>(in);
+  p.header.begin = get<uint64_t>(in);
+  p.header.count = get<uint64_t>(in);
+  p.solved.resize((p.header.count + 7) / 8);
+  in.read(reinterpret_cast<char*>(p.solved.data()), p.solved.size());
+  return static_cast<bool>(in);
+}
+
+template <std::size_t N>
+Partial run_shard(int max_value, uint64_t shard, uint64_t shards) {
+  Partial p;
+  p.header.n = N;
+  p.header.max_value = static_cast<uint16_t>(max_value);
+  p.header.total = multisets(max_value, N);
+  p.header.begin = p.header.total * shard / shards;
+  p.header.count = p.header.total * (shard + 1) / shards - p.header.begin;
+  p.solved.assign((p.header.count + 7) / 8, 0);
+
+  auto hand = unrank<N>(p.header.begin, max_value);
+  std::array<double, N> a;
+  for (uint64_t k = 0; k < p.header.count; ++k) {
+    for (std::size_t i = 0; i < N; ++i) a[i] = hand[i];
+    if (calc24(a).has_value()) p.solved[k / 8] |= 1 << (k % 8);
+    next_hand(hand, max_value);
+  }
+  return p;
+}
+
+int run(int argc, char** argv) {
+  if (argc != 7) return 2;
+  const int n = std::atoi(argv[2]);
+  const int max_value = std::atoi(argv[3]);
+  const uint64_t shard = std::strtoull(argv[4], nullptr, 10);
+  const uint64_t shards = std::strtoull(argv[5], nullptr, 10);
+  if (max_value < 1 || max_value > UINT16_MAX || shards == 0 ||
+      shard >= shards) {
+    return 2;
+  }
+
+  Partial p;
+  switch (n) {
+    case 2: p = run_shard<2>(max_value, shard, shards); break;
+    case 3: p = run_shard<3>(max_value, shard, shards); break;
+    case 4: p = run_shard<4>(max_value, shard, shards); break;
+    case 5: p = run_shard<5>(max_value, shard, shards); break;
+    case 6: p = run_shard<6>(max_value, shard, shards); break;
+    default:
+      std::cerr << "N must be between 2 and 6" << std::endl;
+      return 2;
+  }
+  if (!write_partial(argv[6], p)) {
+    std::cerr << "cannot write " << argv[6] << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int merge(int argc, char** argv) {
+  if (argc < 4) return 2;
+  std::vector<Partial> parts(argc - 3);
+  for (int i = 3; i < argc; ++i) {
+    if (!read_partial(argv[i], parts[i - 3])) {
+      std::cerr << "cannot read " << argv[i] << std::endl;
+      return 1;
+    }
+  }
+  std::sort(parts.begin(), parts.end(), [](const auto& x, const auto& y) {
+    return x.header.begin < y.header.begin;
+  });
+
+  Partial merged;
+  merged.header = parts[0].header;
+  merged.header.begin = 0;
+  merged.header.count = merged.header.total;
+  merged.solved.assign((merged.header.total + 7) / 8, 0);
+
+  uint64_t next = 0;
+  uint64_t solvable = 0;
+  for (const auto& part : parts) {
+    const Header& h = part.header;
+    if (h.n != merged.header.n || h.max_value != merged.header.max_value ||
+        h.total != merged.header.total || h.begin != next) {
+      std::cerr << "partial files do not tile hands " << next << ".."
+                << merged.header.total << std::endl;
+      return 1;
+    }
+    for (uint64_t k = 0; k < h.count; ++k) {
+      if (part.solved[k / 8] >> (k % 8) & 1) {
+        merged.solved[(next + k) / 8] |= 1 << ((next + k) % 8);
+        ++solvable;
+      }
+    }
+    next += h.count;
+  }
+  if (next != merged.header.total) {
+    std::cerr << "missing hands " << next << ".." << merged.header.total
+              << std::endl;
+    return 1;
+  }
+
+  if (!write_partial(argv[2], merged)) {
+    std::cerr << "cannot write " << argv[2] << std::endl;
+    return 1;
+  }
+  std::cout << solvable << " of " << merged.header.total
+            << " hands solvable" << std::endl;
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int status = 2;
+  if (argc > 1 && std::strcmp(argv[1], "run") == 0) {
+    status = run(argc, argv);
+  } else if (argc > 1 && std::strcmp(argv[1], "merge") == 0) {
+    status = merge(argc, argv);
+  }
+  if (status == 2) {
+    std::cerr << "usage: meta24_sweep run N V SHARD SHARDS OUT\n"
+                 "       meta24_sweep merge OUT PARTIAL..."
+              << std::endl;
+  }
+  return status;
+}
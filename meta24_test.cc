@@ -1,4 +1,4 @@
-#include "meta24.h"
+#include "meta24_prebuilt.h"
 
 #include <gtest/gtest.h>
 
@@ -21,4 +21,9 @@ TEST(Calc24Test, Basic4Numbers) {
 TEST(Calc24Test, FractionalCalc) {
   const auto result = calc24(std::array<double, 4> {3, 3, 7, 7});
   EXPECT_TRUE(result.has_value());
-}
\ No newline at end of file
+}
+
+TEST(Calc24Test, RuntimeTarget) {
+  EXPECT_TRUE(calc24(std::array<double, 3> {1, 1, 1}, 3).has_value());
+  EXPECT_FALSE(calc24(std::array<double, 3> {1, 1, 1}, 4).has_value());
+}